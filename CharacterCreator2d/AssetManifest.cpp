@@ -0,0 +1,239 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "AssetManifest.h"
+
+AssetManifest::AssetManifest(const QString &manifestPath)
+	: manifestPath(manifestPath)
+{
+
+}
+
+bool AssetManifest::read(assetIndexData &index) const
+{
+	index = assetIndexData{};
+
+	QFile fileRead(manifestPath);
+	if (!fileRead.open(QIODevice::ReadOnly))
+		return false;
+
+	// The whole manifest is pulled in with one read and decoded from memory.
+	const QByteArray manifestBytes = fileRead.readAll();
+	fileRead.close();
+
+	QDataStream stream(manifestBytes);
+	stream.setVersion(QDataStream::Qt_5_12);
+
+	quint32 magic;
+	quint32 version;
+	stream >> magic >> version;
+	if (stream.status() != QDataStream::Ok || magic != manifestMagic || version != manifestVersion)
+		return false;
+
+	quint32 poseCount;
+	stream >> poseCount;
+	for (quint32 i = 0; i < poseCount && stream.status() == QDataStream::Ok; i++)
+	{
+		assetIndexPoseData poseIndex{};
+		stream >> poseIndex.path;
+		if (!readStampList(stream, poseIndex.stampList))
+			break;
+		quint32 overrideCount;
+		stream >> overrideCount;
+		for (quint32 j = 0; j < overrideCount && stream.status() == QDataStream::Ok; j++)
+		{
+			qint32 component;
+			qint32 displayOrderZ;
+			stream >> component >> displayOrderZ;
+			// Out of range values would index past the end of the component tables, so the whole manifest
+			// is treated as corrupt and everything gets rescanned.
+			if (component < 0 || static_cast<std::size_t>(component) >= componentTypeCount)
+			{
+				stream.setStatus(QDataStream::ReadCorruptData);
+				break;
+			}
+			poseIndex.displayOrderZOverrideMap.try_emplace(static_cast<ComponentType>(component), displayOrderZ);
+		}
+		index.poseList.emplace_back(std::move(poseIndex));
+	}
+
+	quint32 componentCount;
+	stream >> componentCount;
+	for (quint32 i = 0; i < componentCount && stream.status() == QDataStream::Ok; i++)
+	{
+		assetIndexComponentData componentIndex{};
+		stream >> componentIndex.path;
+		if (!readStampList(stream, componentIndex.stampList))
+			break;
+		quint32 assetCount;
+		stream >> assetCount;
+		for (quint32 j = 0; j < assetCount && stream.status() == QDataStream::Ok; j++)
+		{
+			assetIndexAssetData assetIndex;
+			if (!readAsset(stream, assetIndex))
+				break;
+			componentIndex.assetList.emplace_back(std::move(assetIndex));
+		}
+		index.componentList.emplace_back(std::move(componentIndex));
+	}
+
+	if (stream.status() != QDataStream::Ok)
+	{
+		index = assetIndexData{};
+		return false;
+	}
+	return true;
+}
+
+bool AssetManifest::write(const assetIndexData &index) const
+{
+	// QSaveFile only replaces the old manifest once the new one is fully written,
+	// so a crash mid-write can't leave a half-written cache behind.
+	QSaveFile fileWrite(manifestPath);
+	if (!fileWrite.open(QIODevice::WriteOnly))
+		return false;
+
+	QDataStream stream(&fileWrite);
+	stream.setVersion(QDataStream::Qt_5_12);
+	stream << manifestMagic << manifestVersion;
+
+	stream << quint32(index.poseList.size());
+	for (const auto& poseIndex : index.poseList)
+	{
+		stream << poseIndex.path;
+		writeStampList(stream, poseIndex.stampList);
+		stream << quint32(poseIndex.displayOrderZOverrideMap.size());
+		for (const auto& overridePair : poseIndex.displayOrderZOverrideMap)
+			stream << qint32(overridePair.first) << qint32(overridePair.second);
+	}
+
+	stream << quint32(index.componentList.size());
+	for (const auto& componentIndex : index.componentList)
+	{
+		stream << componentIndex.path;
+		writeStampList(stream, componentIndex.stampList);
+		stream << quint32(componentIndex.assetList.size());
+		for (const auto& assetIndex : componentIndex.assetList)
+			writeAsset(stream, assetIndex);
+	}
+
+	if (stream.status() != QDataStream::Ok)
+	{
+		fileWrite.cancelWriting();
+		return false;
+	}
+	return fileWrite.commit();
+}
+
+void AssetManifest::writeStampList(QDataStream &stream, const std::vector<assetIndexStampData> &stampList) const
+{
+	stream << quint32(stampList.size());
+	for (const auto& stamp : stampList)
+		stream << stamp.path << stamp.lastModified << stamp.size;
+}
+
+bool AssetManifest::readStampList(QDataStream &stream, std::vector<assetIndexStampData> &stampList) const
+{
+	quint32 stampCount;
+	stream >> stampCount;
+	for (quint32 i = 0; i < stampCount && stream.status() == QDataStream::Ok; i++)
+	{
+		assetIndexStampData stamp;
+		stream >> stamp.path >> stamp.lastModified >> stamp.size;
+		stampList.emplace_back(std::move(stamp));
+	}
+	return stream.status() == QDataStream::Ok;
+}
+
+void AssetManifest::writeAsset(QDataStream &stream, const assetIndexAssetData &asset) const
+{
+	stream
+		<< asset.imgFilename << asset.imgFillPath << asset.imgOutlinePath << asset.imgThumbnailPath
+		<< asset.imgFillBounds << asset.imgOutlineBounds << asset.relativePos;
+
+	stream << quint32(asset.subColorList.size());
+	for (const auto& subColor : asset.subColorList)
+		stream << subColor.imgFilename << subColor.imgPath << subColor.imgBounds;
+
+	stream << asset.hasAnimation;
+	if (asset.hasAnimation)
+	{
+		const auto& animation = asset.animation;
+		stream
+			<< animation.animationSequence
+			<< qint32(animation.duration)
+			<< animation.animateOutline
+			<< animation.animateFill
+			<< animation.repeating
+			<< qint32(animation.repeatingTimeRange.first)
+			<< qint32(animation.repeatingTimeRange.second)
+			<< qint32(animation.easingCurve);
+		stream << quint32(animation.frameList.size());
+		for (const auto& frame : animation.frameList)
+			stream << frame.imgOutlinePath << frame.imgFillPath << frame.imgOutlineBounds << frame.imgFillBounds;
+	}
+}
+
+bool AssetManifest::readAsset(QDataStream &stream, assetIndexAssetData &asset) const
+{
+	stream
+		>> asset.imgFilename >> asset.imgFillPath >> asset.imgOutlinePath >> asset.imgThumbnailPath
+		>> asset.imgFillBounds >> asset.imgOutlineBounds >> asset.relativePos;
+
+	quint32 subColorCount;
+	stream >> subColorCount;
+	for (quint32 i = 0; i < subColorCount && stream.status() == QDataStream::Ok; i++)
+	{
+		assetIndexSubColorData subColor;
+		stream >> subColor.imgFilename >> subColor.imgPath >> subColor.imgBounds;
+		asset.subColorList.emplace_back(std::move(subColor));
+	}
+
+	stream >> asset.hasAnimation;
+	if (asset.hasAnimation && stream.status() == QDataStream::Ok)
+	{
+		auto& animation = asset.animation;
+		qint32 duration;
+		qint32 repeatingTimeMin;
+		qint32 repeatingTimeMax;
+		qint32 easingCurve;
+		stream
+			>> animation.animationSequence
+			>> duration
+			>> animation.animateOutline
+			>> animation.animateFill
+			>> animation.repeating
+			>> repeatingTimeMin
+			>> repeatingTimeMax
+			>> easingCurve;
+		animation.duration = duration;
+		animation.repeatingTimeRange = { repeatingTimeMin, repeatingTimeMax };
+		if (easingCurve < 0 || easingCurve >= QEasingCurve::NCurveTypes)
+		{
+			stream.setStatus(QDataStream::ReadCorruptData);
+			return false;
+		}
+		animation.easingCurve = static_cast<QEasingCurve::Type>(easingCurve);
+
+		quint32 frameCount;
+		stream >> frameCount;
+		for (quint32 i = 0; i < frameCount && stream.status() == QDataStream::Ok; i++)
+		{
+			assetIndexFrameData frame;
+			stream >> frame.imgOutlinePath >> frame.imgFillPath >> frame.imgOutlineBounds >> frame.imgFillBounds;
+			animation.frameList.emplace_back(std::move(frame));
+		}
+	}
+	return stream.status() == QDataStream::Ok;
+}
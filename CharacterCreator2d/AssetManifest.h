@@ -0,0 +1,40 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include "AssetScanner.h"
+#include <QDataStream>
+#include <QSaveFile>
+
+// Binary cache of the asset index, written next to the executable after a scan.
+// On the next launch it is read back and handed to AssetScanner, which checks each task's stamps
+// and only rescans the folders that changed. If the file is missing, from an older version, or damaged,
+// reading fails and the scanner simply does a full scan.
+class AssetManifest
+{
+public:
+	AssetManifest(const QString &manifestPath);
+	bool read(assetIndexData &index) const;
+	bool write(const assetIndexData &index) const;
+
+private:
+	const QString manifestPath;
+	const quint32 manifestMagic = 0x5A32444D; // "Z2DM"
+	const quint32 manifestVersion = 2; // Bump whenever the layout below changes.
+
+	void writeStampList(QDataStream &stream, const std::vector<assetIndexStampData> &stampList) const;
+	bool readStampList(QDataStream &stream, std::vector<assetIndexStampData> &stampList) const;
+	void writeAsset(QDataStream &stream, const assetIndexAssetData &asset) const;
+	bool readAsset(QDataStream &stream, assetIndexAssetData &asset) const;
+};
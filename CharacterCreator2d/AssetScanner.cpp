@@ -0,0 +1,497 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "AssetScanner.h"
+
+AssetScanner::AssetScanner(const QString &speciesRootPath)
+	: speciesRootPath(speciesRootPath)
+{
+
+}
+
+assetIndexData AssetScanner::scan(assetIndexData &cachedIndex)
+{
+	assetIndexData index;
+	rescannedTasks = 0;
+
+	// Cached tasks are matched by folder path. Each path belongs to exactly one task,
+	// so workers can move cached data out of these without stepping on each other.
+	QHash<QString, assetIndexPoseData*> cachedPoseMap;
+	for (auto& poseIndex : cachedIndex.poseList)
+		cachedPoseMap.insert(poseIndex.path, &poseIndex);
+	QHash<QString, assetIndexComponentData*> cachedComponentMap;
+	for (auto& componentIndex : cachedIndex.componentList)
+		cachedComponentMap.insert(componentIndex.path, &componentIndex);
+
+	// Build the full task list up front, so the vectors don't reallocate while workers are writing into them.
+	for (const auto& species : speciesTypeMap)
+	{
+		for (const auto& gender : genderTypeMap)
+		{
+			for (const auto& pose : poseTypeMap)
+			{
+				const QString posePath =
+					speciesRootPath + "/" +
+					species.second.assetStr + "/" +
+					gender.second + "/" +
+					pose.second;
+
+				index.poseList.emplace_back
+				(
+					assetIndexPoseData{ species.first, gender.first, pose.first, posePath, {} }
+				);
+
+				for (const auto& componentSettings : species.second.componentMapRef)
+				{
+					index.componentList.emplace_back
+					(
+						assetIndexComponentData
+						{
+							species.first,
+							gender.first,
+							pose.first,
+							componentSettings.first,
+							posePath + "/" + componentSettings.second.assetStr,
+							{}
+						}
+					);
+				}
+			}
+		}
+	}
+
+	// Each task only writes into its own element, so no locking is needed here.
+	// Most of the cost is in filesystem probes, which overlap well across the pool.
+	QtConcurrent::blockingMap(index.poseList, [&](assetIndexPoseData &poseIndex) {
+		auto cached = cachedPoseMap.constFind(poseIndex.path);
+		if (cached != cachedPoseMap.constEnd() && stampsUnchanged(cached.value()->stampList))
+		{
+			poseIndex.stampList = std::move(cached.value()->stampList);
+			poseIndex.displayOrderZOverrideMap = std::move(cached.value()->displayOrderZOverrideMap);
+		}
+		else
+		{
+			scanPose(poseIndex);
+			rescannedTasks++;
+		}
+	});
+	QtConcurrent::blockingMap(index.componentList, [&](assetIndexComponentData &componentIndex) {
+		auto cached = cachedComponentMap.constFind(componentIndex.path);
+		if (cached != cachedComponentMap.constEnd() && stampsUnchanged(cached.value()->stampList))
+		{
+			componentIndex.stampList = std::move(cached.value()->stampList);
+			componentIndex.assetList = std::move(cached.value()->assetList);
+		}
+		else
+		{
+			scanComponent(componentIndex);
+			rescannedTasks++;
+		}
+	});
+
+	for (const auto& componentIndex : index.componentList)
+	{
+		for (const auto& assetIndex : componentIndex.assetList)
+		{
+			if (assetIndex.hasAnimation)
+			{
+				index.animationFound = true;
+				break;
+			}
+		}
+	}
+
+	return index;
+}
+
+int AssetScanner::rescannedTaskCount() const
+{
+	return rescannedTasks;
+}
+
+void AssetScanner::scanPose(assetIndexPoseData &poseIndex) const
+{
+	// We design override list to only be relevant if one is found and contains applicable overrides.
+	// Otherwise, default order list is used for any given pose.
+	const QString displayOrderOverridePath = poseIndex.path + "/displayOrderOverride.txt";
+	addStamp(poseIndex.stampList, displayOrderOverridePath);
+	if (!QFile(displayOrderOverridePath).exists())
+		return;
+
+	QStringList displayOrderOverrideList;
+	QFile fileRead(displayOrderOverridePath);
+	if (fileRead.open(QIODevice::ReadOnly))
+	{
+		QTextStream qStream(&fileRead);
+		while (!qStream.atEnd())
+		{
+			QString line = qStream.readLine();
+			if (line.startsWith("//"))
+				continue;
+			displayOrderOverrideList.append(line);
+		}
+		fileRead.close();
+	}
+
+	if (displayOrderOverrideList.isEmpty())
+		return;
+
+	for (const auto& componentSettings : speciesTypeMap.at(poseIndex.species).componentMapRef)
+	{
+		const QString key = componentSettings.second.assetStr + "=";
+		QString componentLine;
+		for (const auto& line : displayOrderOverrideList)
+			if (line.contains(key))
+				componentLine = line;
+		if (!componentLine.isEmpty())
+			poseIndex.displayOrderZOverrideMap.try_emplace(componentSettings.first, extractValue(key, componentLine).toInt());
+	}
+}
+
+void AssetScanner::scanComponent(assetIndexComponentData &componentIndex) const
+{
+	addStamp(componentIndex.stampList, componentIndex.path);
+	const QStringList assetFolderPathList = fileGetAssetDirectoriesOnStartup(componentIndex.path);
+
+	// Note: We store as filename only (e.g. NOT including full path),
+	// so that if exe moves, character saves can still be loaded correctly in relation to loaded assets.
+	for (const auto& assetFolderPath : assetFolderPathList)
+	{
+		// Stamps are taken before reading, so an edit made mid-scan shows up as a change next launch.
+		addStamp(componentIndex.stampList, assetFolderPath);
+		addStamp(componentIndex.stampList, assetFolderPath + "/pos.zen2dpos");
+
+		assetIndexAssetData assetIndex;
+		assetIndex.imgFilename = QDir(assetFolderPath).dirName();
+		assetIndex.imgFillPath = getPathIfExists(assetFolderPath, AssetImgType::FILL);
+		assetIndex.imgOutlinePath = getPathIfExists(assetFolderPath, AssetImgType::OUTLINE);
+		assetIndex.imgThumbnailPath = getPathIfExists(assetFolderPath, AssetImgType::THUMBNAIL);
+		assetIndex.imgFillBounds = imageBounds(componentIndex.stampList, assetIndex.imgFillPath);
+		assetIndex.imgOutlineBounds = imageBounds(componentIndex.stampList, assetIndex.imgOutlinePath);
+		assetIndex.relativePos = getRelativePos(assetFolderPath + "/pos.zen2dpos");
+
+		// An empty multicolor folder stops the search for this asset (animation is not looked for).
+		bool multicolorFolderEmpty = false;
+		const QString multicolorPath = assetFolderPath + "/multicolor";
+		if (QDir(multicolorPath).exists())
+		{
+			addStamp(componentIndex.stampList, multicolorPath);
+			const QStringList multicolorPathList = fileGetAssets(multicolorPath);
+			multicolorFolderEmpty = multicolorPathList.isEmpty();
+			for (const auto& colorPath : multicolorPathList)
+			{
+				assetIndex.subColorList.emplace_back
+				(
+					assetIndexSubColorData{ QFileInfo(colorPath).baseName(), colorPath, imageBounds(componentIndex.stampList, colorPath) }
+				);
+			}
+		}
+
+		const QString animationPath = assetFolderPath + "/animation";
+		if (!multicolorFolderEmpty && QDir(animationPath).exists())
+		{
+			addStamp(componentIndex.stampList, animationPath);
+			addStamp(componentIndex.stampList, animationPath + "/animationProperties.zen2dani");
+			scanAnimation(animationPath, assetIndex);
+			for (auto& frame : assetIndex.animation.frameList)
+			{
+				frame.imgOutlineBounds = imageBounds(componentIndex.stampList, frame.imgOutlinePath);
+				frame.imgFillBounds = imageBounds(componentIndex.stampList, frame.imgFillPath);
+			}
+		}
+
+		componentIndex.assetList.emplace_back(std::move(assetIndex));
+	}
+}
+
+void AssetScanner::scanAnimation(const QString &animationPath, assetIndexAssetData &assetIndex) const
+{
+	const QString animationPropertiesPath = animationPath + "/animationProperties.zen2dani";
+	if (!QFile(animationPropertiesPath).exists())
+		return;
+
+	assetIndex.hasAnimation = true;
+	auto& animation = assetIndex.animation;
+
+	QFile fileRead(animationPropertiesPath);
+	if (fileRead.open(QIODevice::ReadOnly))
+	{
+		QTextStream qStream(&fileRead);
+		while (!qStream.atEnd())
+		{
+			QString line = qStream.readLine();
+			if (line.contains("animationSequence="))
+				animation.animationSequence = extractBracketedList(line);
+			else if (line.contains("animationDuration="))
+				animation.duration = extractValue("animationDuration=", line).toInt();
+			else if (line.contains("animateOutline="))
+				animation.animateOutline = QVariant(extractValue("animateOutline=", line)).toBool();
+			else if (line.contains("animateFill="))
+				animation.animateFill = QVariant(extractValue("animateFill=", line)).toBool();
+			else if (line.contains("repeating="))
+				animation.repeating = QVariant(extractValue("repeating=", line)).toBool();
+			else if (line.contains("repeatingTimeRange="))
+			{
+				QStringList repeatingTimeRangeNumList = extractBracketedList(line);
+				animation.repeatingTimeRange.first = repeatingTimeRangeNumList[0].toInt();
+				animation.repeatingTimeRange.second = repeatingTimeRangeNumList[1].toInt();
+			}
+			else if (line.contains("easingCurve="))
+				animation.easingCurve = qstringToEasingCurveType(extractValue("easingCurve=", line));
+		}
+		fileRead.close();
+	}
+
+	for (const auto& num : animation.animationSequence)
+	{
+		animation.frameList.emplace_back
+		(
+			assetIndexFrameData
+			{
+				getPathIfExistsAnimation(animationPath + "/" + num, animation.animateOutline, AssetImgType::OUTLINE),
+				getPathIfExistsAnimation(animationPath + "/" + num, animation.animateFill, AssetImgType::FILL)
+			}
+		);
+	}
+}
+
+void AssetScanner::addStamp(std::vector<assetIndexStampData> &stampList, const QString &path) const
+{
+	const QFileInfo info(path);
+	if (info.exists())
+		stampList.emplace_back(assetIndexStampData{ path, info.lastModified().toMSecsSinceEpoch(), info.size() });
+	else
+		stampList.emplace_back(assetIndexStampData{ path, -1, -1 });
+}
+
+// Decodes the image to find its alpha bounds. The image is stamped too, since unlike the rest of what we record,
+// bounds can change from an in-place edit that leaves the folder's modified time alone.
+// Resource paths (ex: the error image) never change, so they aren't stamped.
+QRect AssetScanner::imageBounds(std::vector<assetIndexStampData> &stampList, const QString &path) const
+{
+	if (path.isEmpty())
+		return QRect();
+	if (!path.startsWith(":"))
+		addStamp(stampList, path);
+	return RecolorKernel::alphaBounds(QImage(path));
+}
+
+// Directory modified times change when entries are added, removed or renamed,
+// and file stamps catch in-place edits of the files we parse (ex: pos.zen2dpos).
+bool AssetScanner::stampsUnchanged(const std::vector<assetIndexStampData> &stampList) const
+{
+	if (stampList.empty())
+		return false;
+	for (const auto& stamp : stampList)
+	{
+		const QFileInfo info(stamp.path);
+		if (!info.exists())
+		{
+			if (stamp.lastModified != -1)
+				return false;
+		}
+		else if (info.lastModified().toMSecsSinceEpoch() != stamp.lastModified || info.size() != stamp.size)
+			return false;
+	}
+	return true;
+}
+
+// Returns everything after the key (ex: "x=" in "x=25" gives "25").
+QString AssetScanner::extractValue(const QString &key, const QString &line) const
+{
+	return line.mid(line.indexOf(key) + key.length());
+}
+
+// Returns the contents of each [bracketed] item in the line, in order.
+QStringList AssetScanner::extractBracketedList(const QString &line) const
+{
+	QStringList extracted;
+	int posFound = 0;
+	while (line.indexOf("[", posFound) != -1)
+	{
+		int posBegin = line.indexOf("[", posFound) + 1;
+		int posEnd = line.indexOf("]", posBegin);
+		extracted.append(line.mid(posBegin, posEnd - posBegin));
+		posFound = posEnd;
+	}
+	return extracted;
+}
+
+QStringList AssetScanner::fileGetAssetDirectoriesOnStartup(const QString &path) const
+{
+	QStringList assetPathList;
+	QDirIterator dirIt(path, QDir::AllDirs | QDir::NoDotAndDotDot);
+	while (dirIt.hasNext())
+	{
+		QString assetPath = dirIt.next();
+		if (QFileInfo(assetPath).isDir())
+			assetPathList.append(assetPath);
+	}
+	return assetPathList;
+}
+
+QStringList AssetScanner::fileGetAssets(const QString &path) const
+{
+	QStringList assetPathList;
+	QDirIterator dirIt(path);
+	while (dirIt.hasNext())
+	{
+		QString assetPath = dirIt.next();
+		if (QFileInfo(assetPath).suffix() == "png")
+			assetPathList.append(assetPath);
+	}
+	return assetPathList;
+}
+
+QString AssetScanner::getPathIfExists(const QString &assetFolderPath, const AssetImgType &assetImgType) const
+{
+	QString imgPath = assetFolderPath + "/" + QDir(assetFolderPath).dirName();
+	for (const auto& naming : assetImgTypeMap.at(assetImgType))
+	{
+		QString namePath = imgPath + naming + imgExtensionStandard;
+		if (QFile(namePath).exists())
+			return namePath;
+	}
+	return imgErrorPath;
+}
+
+QString AssetScanner::getPathIfExistsAnimation(const QString &assetAnimationPath, const bool existenceExpected, const AssetImgType &assetImgType) const
+{
+	if (existenceExpected)
+	{
+		for (const auto& naming : assetImgTypeMap.at(assetImgType))
+		{
+			QString namePath = assetAnimationPath + naming + imgExtensionStandard;
+			if (QFile(namePath).exists())
+				return namePath;
+		}
+		return imgErrorPath;
+	}
+	else
+		return QString();
+}
+
+QPoint AssetScanner::getRelativePos(const QString &posPath) const
+{
+	int x = 0;
+	int y = 0;
+	QFile fileRead(posPath);
+	if (fileRead.open(QIODevice::ReadOnly))
+	{
+		QTextStream qStream(&fileRead);
+		while (!qStream.atEnd())
+		{
+			QString line = qStream.readLine();
+			if (line.contains("x="))
+				x = extractValue("x=", line).toInt();
+			else if (line.contains("y="))
+				y = extractValue("y=", line).toInt();
+		}
+		fileRead.close();
+		return QPoint(x, y);
+	}
+	return QPoint(0, 0);
+}
+
+QEasingCurve::Type AssetScanner::qstringToEasingCurveType(const QString &str) const
+{
+	if (str == "Linear")
+		return QEasingCurve::Linear;
+	else if (str == "InQuad")
+		return QEasingCurve::InQuad;
+	else if (str == "OutQuad")
+		return QEasingCurve::OutQuad;
+	else if (str == "InOutQuad")
+		return QEasingCurve::InOutQuad;
+	else if (str == "OutInQuad")
+		return QEasingCurve::OutInQuad;
+	else if (str == "InCubic")
+		return QEasingCurve::InCubic;
+	else if (str == "OutCubic")
+		return QEasingCurve::OutCubic;
+	else if (str == "InOutCubic")
+		return QEasingCurve::InOutCubic;
+	else if (str == "OutInCubic")
+		return QEasingCurve::OutInCubic;
+	else if (str == "InQuart")
+		return QEasingCurve::InQuart;
+	else if (str == "OutQuart")
+		return QEasingCurve::OutQuart;
+	else if (str == "InOutQuart")
+		return QEasingCurve::InOutQuart;
+	else if (str == "OutInQuart")
+		return QEasingCurve::OutInQuart;
+	else if (str == "InQuint")
+		return QEasingCurve::InQuint;
+	else if (str == "OutQuint")
+		return QEasingCurve::OutQuint;
+	else if (str == "InOutQuint")
+		return QEasingCurve::InOutQuint;
+	else if (str == "OutInQuint")
+		return QEasingCurve::OutInQuint;
+	else if (str == "InSine")
+		return QEasingCurve::InSine;
+	else if (str == "OutSine")
+		return QEasingCurve::OutSine;
+	else if (str == "InOutSine")
+		return QEasingCurve::InOutSine;
+	else if (str == "OutInSine")
+		return QEasingCurve::OutInSine;
+	else if (str == "InExpo")
+		return QEasingCurve::InExpo;
+	else if (str == "OutExpo")
+		return QEasingCurve::OutExpo;
+	else if (str == "InOutExpo")
+		return QEasingCurve::InOutExpo;
+	else if (str == "OutInExpo")
+		return QEasingCurve::OutInExpo;
+	else if (str == "InCirc")
+		return QEasingCurve::InCirc;
+	else if (str == "OutCirc")
+		return QEasingCurve::OutCirc;
+	else if (str == "InOutCirc")
+		return QEasingCurve::InOutCirc;
+	else if (str == "OutInCirc")
+		return QEasingCurve::OutInCirc;
+	else if (str == "InElastic")
+		return QEasingCurve::InElastic;
+	else if (str == "OutElastic")
+		return QEasingCurve::OutElastic;
+	else if (str == "InOutElastic")
+		return QEasingCurve::InOutElastic;
+	else if (str == "OutInElastic")
+		return QEasingCurve::OutInElastic;
+	else if (str == "InBack")
+		return QEasingCurve::InBack;
+	else if (str == "OutBack")
+		return QEasingCurve::OutBack;
+	else if (str == "InOutBack")
+		return QEasingCurve::InOutBack;
+	else if (str == "OutInBack")
+		return QEasingCurve::OutInBack;
+	else if (str == "InBounce")
+		return QEasingCurve::InBounce;
+	else if (str == "OutBounce")
+		return QEasingCurve::OutBounce;
+	else if (str == "InOutBounce")
+		return QEasingCurve::InOutBounce;
+	else if (str == "OutInBounce")
+		return QEasingCurve::OutInBounce;
+	else if (str == "BezierSpline")
+		return QEasingCurve::BezierSpline;
+	else if (str == "TCBSpline")
+		return QEasingCurve::TCBSpline;
+	else
+		return QEasingCurve::Linear;
+}
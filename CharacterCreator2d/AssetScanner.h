@@ -0,0 +1,164 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include "theme.h"
+#include "RecolorKernel.h"
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QImage>
+#include <QRect>
+#include <QTextStream>
+#include <QVariant>
+#include <QEasingCurve>
+#include <QtConcurrent/QtConcurrent>
+#include <vector>
+#include <map>
+#include <atomic>
+
+// The asset index is a plain-data picture of what was found in the Assets folder.
+// It holds no widgets or pixmaps, so it can be built on worker threads and handed
+// to GraphicsDisplay afterwards, which turns it into the speciesMap hierarchy.
+
+// Recorded for every directory and parsed file a scan task depends on, so a cached task can be
+// checked against the disk with a handful of stat calls instead of being rescanned.
+struct assetIndexStampData
+{
+	QString path;
+	qint64 lastModified = -1; // -1 if the path didn't exist when it was scanned.
+	qint64 size = -1;
+};
+
+// Alpha bounds are the smallest rect around an image's non-transparent pixels (empty if there are none).
+// They're worked out once here, so recoloring, the scene and export can skip the transparent margins
+// without looking at the pixels again.
+struct assetIndexFrameData
+{
+	QString imgOutlinePath;
+	QString imgFillPath;
+	QRect imgOutlineBounds;
+	QRect imgFillBounds;
+};
+
+struct assetIndexSubColorData
+{
+	QString imgFilename;
+	QString imgPath;
+	QRect imgBounds;
+};
+
+struct assetIndexAnimationData
+{
+	QStringList animationSequence;
+	int duration = 0;
+	bool animateOutline = false;
+	bool animateFill = false;
+	bool repeating = false;
+	std::pair<int, int> repeatingTimeRange = { 0, 0 };
+	QEasingCurve::Type easingCurve = QEasingCurve::Linear;
+	std::vector<assetIndexFrameData> frameList;
+};
+
+struct assetIndexAssetData
+{
+	QString imgFilename;
+	QString imgFillPath;
+	QString imgOutlinePath;
+	QString imgThumbnailPath;
+	QRect imgFillBounds;
+	QRect imgOutlineBounds;
+	QPoint relativePos;
+	std::vector<assetIndexSubColorData> subColorList; // Kept in the order found on disk.
+	bool hasAnimation = false;
+	assetIndexAnimationData animation;
+};
+
+// One scan task: every asset folder under a single species/gender/pose/component folder.
+struct assetIndexComponentData
+{
+	SpeciesType species;
+	GenderType gender;
+	PoseType pose;
+	ComponentType component;
+	QString path;
+	std::vector<assetIndexStampData> stampList;
+	std::vector<assetIndexAssetData> assetList;
+};
+
+// One scan task: pose-level settings (currently just the display order override file).
+struct assetIndexPoseData
+{
+	SpeciesType species;
+	GenderType gender;
+	PoseType pose;
+	QString path;
+	std::vector<assetIndexStampData> stampList;
+	std::map<ComponentType, int> displayOrderZOverrideMap;
+};
+
+struct assetIndexData
+{
+	std::vector<assetIndexPoseData> poseList;
+	std::vector<assetIndexComponentData> componentList;
+	bool animationFound = false;
+};
+
+class AssetScanner
+{
+public:
+	AssetScanner(const QString &speciesRootPath);
+
+	// Tasks found in cachedIndex (ex: loaded from the manifest) are reused as-is if none of their
+	// stamps changed on disk. Everything else is scanned from scratch.
+	assetIndexData scan(assetIndexData &cachedIndex);
+	int rescannedTaskCount() const;
+
+private:
+	const QString speciesRootPath;
+
+	// We can support multiple naming conventions for files here.
+	// Ex: If asset folder is called "tShirt", camel or pascal case will work.
+	// If asset folder is called "t_shirt", snake case will work.
+	const QString imgExtensionStandard = ".png";
+	enum class AssetImgType { FILL, OUTLINE, THUMBNAIL };
+	const std::map<AssetImgType, QStringList> assetImgTypeMap =
+	{
+		{AssetImgType::FILL, QStringList{ "Fill", "_fill", "-fill" } },
+		{AssetImgType::OUTLINE, QStringList{ "Outline", "_outline", "-outline" } },
+		{AssetImgType::THUMBNAIL, QStringList{ "Thumbnail", "_thumbnail", "-thumbnail" } },
+	};
+	const QString imgErrorPath = ":/ZenCharacterCreator2D/Resources/error.png";
+	std::atomic<int> rescannedTasks{ 0 };
+
+	// Both scan functions are run from worker threads, so they only touch the task passed in
+	// and const members of the scanner.
+	void scanPose(assetIndexPoseData &poseIndex) const;
+	void scanComponent(assetIndexComponentData &componentIndex) const;
+	void scanAnimation(const QString &animationPath, assetIndexAssetData &assetIndex) const;
+	void addStamp(std::vector<assetIndexStampData> &stampList, const QString &path) const;
+	QRect imageBounds(std::vector<assetIndexStampData> &stampList, const QString &path) const;
+	bool stampsUnchanged(const std::vector<assetIndexStampData> &stampList) const;
+	QString extractValue(const QString &key, const QString &line) const;
+	QStringList extractBracketedList(const QString &line) const;
+	QStringList fileGetAssetDirectoriesOnStartup(const QString &path) const;
+	QStringList fileGetAssets(const QString &path) const;
+	QString getPathIfExists(const QString &assetFolderPath, const AssetImgType &assetImgType) const;
+	QString getPathIfExistsAnimation(const QString &assetAnimationPath, const bool existenceExpected, const AssetImgType &assetImgType) const;
+	QPoint getRelativePos(const QString &posPath) const;
+	QEasingCurve::Type qstringToEasingCurveType(const QString &str) const;
+};
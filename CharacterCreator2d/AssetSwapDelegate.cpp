@@ -0,0 +1,51 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "AssetSwapDelegate.h"
+
+AssetSwapDelegate::AssetSwapDelegate(ThumbnailService *thumbnailService, QObject *parent)
+	: QStyledItemDelegate(parent), thumbnailService(thumbnailService)
+{
+
+}
+
+void AssetSwapDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+	if (index.data(AssetSwapModel::ChosenRole).toBool())
+		painter->fillRect(option.rect, btnChosenBackground);
+	else if (option.state & QStyle::State_MouseOver)
+		painter->fillRect(option.rect, btnHoverBackground);
+	else
+		painter->fillRect(option.rect, btnBackground);
+
+	// Thumbnails are decoded at the cell's size in device pixels, so they stay sharp on HiDPI screens.
+	// Nothing here waits on a decode: rows that aren't ready get a placeholder and are repainted once they are.
+	const QString thumbnailPath = index.data(AssetSwapModel::ThumbnailPathRole).toString();
+	QPixmap thumbnail;
+	if (!thumbnailService->find(thumbnailPath, option.rect.size(), painter->device()->devicePixelRatioF(), thumbnail))
+	{
+		const int inset = option.rect.width() / 8;
+		painter->fillRect(option.rect.adjusted(inset, inset, -inset, -inset), swapAssetPlaceholderColor);
+		return;
+	}
+
+	const QRect thumbnailRect = QRect(QPoint(0, 0), thumbnail.size() / thumbnail.devicePixelRatioF());
+	painter->drawPixmap(thumbnailRect.translated(option.rect.center() - thumbnailRect.center()), thumbnail);
+}
+
+QSize AssetSwapDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+	return index.data(Qt::SizeHintRole).toSize();
+}
@@ -0,0 +1,39 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "SpeciesData.h"
+#include "AssetSwapModel.h"
+#include "ThumbnailService.h"
+#include <QStyledItemDelegate>
+#include <QStyle>
+#include <QPainter>
+#include <QPixmap>
+
+// Paints one asset of the swap panel the way its button used to look: the thumbnail scaled into the cell,
+// over a background that shows hover and chosen state.
+// Thumbnails come from ThumbnailService; until one is ready, a placeholder is drawn in its place.
+class AssetSwapDelegate : public QStyledItemDelegate
+{
+	Q_OBJECT
+
+public:
+	AssetSwapDelegate(ThumbnailService *thumbnailService, QObject *parent = nullptr);
+	void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+	QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+	ThumbnailService *thumbnailService;
+};
@@ -0,0 +1,101 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "AssetSwapModel.h"
+
+AssetSwapModel::AssetSwapModel(QObject *parent)
+	: QAbstractListModel(parent)
+{
+
+}
+
+void AssetSwapModel::setComponent(const componentData *component, const QSize &itemSize)
+{
+	beginResetModel();
+	currentComponent = component;
+	this->itemSize = itemSize;
+	assetIdList.clear();
+	assetList.clear();
+	rowBySlotList.clear();
+	if (component)
+	{
+		const std::size_t assetCount = component->assetsMap.size();
+		assetIdList.reserve(assetCount);
+		assetList.reserve(assetCount);
+		rowBySlotList.resize(assetCount, -1);
+
+		// "none" always goes first, so there's a consistent place to go to take a part off.
+		const int noneId = internedNames().id("none");
+		if (component->assetsMap.count(noneId) > 0)
+		{
+			assetIdList.emplace_back(noneId);
+			assetList.emplace_back(&component->assetsMap.at(noneId));
+		}
+		for (const auto& asset : component->assetsMap)
+		{
+			if (asset.first == noneId)
+				continue;
+			assetIdList.emplace_back(asset.first);
+			assetList.emplace_back(&asset.second);
+		}
+		for (std::size_t row = 0; row < assetList.size(); row++)
+			rowBySlotList[assetList[row]->slot] = static_cast<int>(row);
+	}
+	endResetModel();
+}
+
+int AssetSwapModel::assetIdAt(const int row) const
+{
+	if (row < 0 || row >= static_cast<int>(assetIdList.size()))
+		return StringInterner::invalidId;
+	return assetIdList[row];
+}
+
+// Repaints the asset's row if it's showing. Called whenever an asset's chosen state is set.
+void AssetSwapModel::chosenChanged(const componentData &component, const assetsData &asset)
+{
+	if (&component != currentComponent)
+		return;
+	const QModelIndex changed = index(rowBySlotList[asset.slot]);
+	emit dataChanged(changed, changed, { ChosenRole });
+}
+
+int AssetSwapModel::rowCount(const QModelIndex &parent) const
+{
+	if (parent.isValid())
+		return 0;
+	return static_cast<int>(assetList.size());
+}
+
+QVariant AssetSwapModel::data(const QModelIndex &index, int role) const
+{
+	if (!index.isValid() || index.row() >= static_cast<int>(assetList.size()))
+		return QVariant();
+
+	const assetsData &asset = *assetList[index.row()];
+	switch (role)
+	{
+	case ThumbnailPathRole:
+		return asset.imgThumbnailPath;
+	case ChosenRole:
+		return currentComponent->chosen(asset);
+	case Qt::ToolTipRole:
+		return asset.imgFilename;
+	case Qt::SizeHintRole:
+		return itemSize;
+	default:
+		return QVariant();
+	}
+}
@@ -0,0 +1,52 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "SpeciesData.h"
+#include <QAbstractListModel>
+#include <QSize>
+#include <QVariant>
+#include <vector>
+
+// The asset column of the swap panel, for one component at a time. Rows only point at the component's assets
+// ("none" first, then the rest by name), so switching components costs a list of pointers instead of showing
+// and hiding a widget per asset. The view (with AssetSwapDelegate) only creates and paints the rows on screen.
+// Holds pointers into the character model, so it has to be pointed elsewhere (or at nothing) before the
+// component it shows goes away.
+class AssetSwapModel : public QAbstractListModel
+{
+	Q_OBJECT
+
+public:
+	enum AssetSwapRole
+	{
+		ThumbnailPathRole = Qt::UserRole + 1,
+		ChosenRole
+	};
+
+	AssetSwapModel(QObject *parent = nullptr);
+	void setComponent(const componentData *component, const QSize &itemSize);
+	int assetIdAt(const int row) const;
+	void chosenChanged(const componentData &component, const assetsData &asset);
+	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+	const componentData *currentComponent = nullptr;
+	QSize itemSize;
+	std::vector<int> assetIdList; // By row.
+	std::vector<const assetsData*> assetList; // By row.
+	std::vector<int> rowBySlotList; // By assetsData::slot.
+};
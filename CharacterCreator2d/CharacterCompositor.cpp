@@ -0,0 +1,57 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "CharacterCompositor.h"
+
+CharacterCompositor::CharacterCompositor(ImageCache &imageCache)
+	: imageCache(imageCache)
+{
+
+}
+
+// Asset layers are painted from decoded images in imageCache, so a color change only costs the painting,
+// not a PNG decode per layer. Tinting (and drawing the outline over the tint) goes through RecolorKernel,
+// which gives the same pixels as QPainter's SourceIn fill + SourceOver draw in a single pass.
+// Multicolor assets are composited in one pass over the output too, with each sub-color only touching
+// the rows and columns its mask actually covers.
+// Only the asset's alpha bounds are painted; everything outside them would come out fully transparent.
+// A fully transparent asset (ex: a component's "none" choice) has empty bounds, and gets an empty layer
+// rather than a null one, so it still replaces whatever the part showed before.
+// Animation frames always get their outline, whatever the part's color set type.
+QImage CharacterCompositor::layer(const recolorJobData &job) const
+{
+	if (job.bounds.isEmpty())
+		return RecolorKernel::emptyLayer();
+
+	if (job.frameNum < 0 && job.colorSetType == ColorSetType::NONE)
+		return imageCache.image(job.imgOutlinePath).copy(job.bounds);
+
+	const QImage outline = job.frameNum >= 0 || job.colorSetType == ColorSetType::FILL_WITH_OUTLINE
+		? imageCache.image(job.imgOutlinePath)
+		: QImage();
+
+	if (job.paintType == PaintType::SINGLE)
+	{
+		return RecolorKernel::tint(imageCache.alphaMask(job.imgFillPath), job.color, outline, job.bounds);
+	}
+	else if (job.paintType == PaintType::COMBINED)
+	{
+		std::vector<RecolorKernel::layerData> layers;
+		for (const auto& subColor : job.subColorList)
+			layers.emplace_back(RecolorKernel::layerData{ imageCache.alphaMask(subColor.imgPath), subColor.color, subColor.alphaBounds });
+		return RecolorKernel::composite(imageCache.alphaMask(job.imgFillPath).size(), layers, outline, job.bounds);
+	}
+	return QImage();
+}
@@ -0,0 +1,65 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "theme.h"
+#include "ImageCache.h"
+#include "RecolorKernel.h"
+#include <QImage>
+#include <QColor>
+#include <QRect>
+#include <QByteArray>
+#include <vector>
+
+// Setting for painting recolored image as whole, or as multicolored parts.
+enum class PaintType { SINGLE, COMBINED };
+
+struct recolorJobSubColorData
+{
+	QString imgPath;
+	QColor color;
+	QRect alphaBounds;
+};
+
+// Everything needed to paint one layer (a still layer, or one animation frame), copied out of the character
+// so the layer can be painted on a worker thread while the character keeps being edited.
+struct recolorJobData
+{
+	quint64 generation = 0; // Which request for the part this belongs to (see componentUiData::recolorGeneration).
+	int frameNum = -1; // -1 for the still layer.
+	qreal step = 0; // Where an animation frame goes in the QPropertyAnimation (0 to 1).
+	QByteArray cacheKey;
+	PaintType paintType = PaintType::SINGLE;
+	ColorSetType colorSetType = ColorSetType::NONE;
+	QString imgFillPath;
+	QString imgOutlinePath;
+	QColor color;
+	QRect bounds; // The asset's alpha bounds; the painted layer covers just this rect.
+	std::vector<recolorJobSubColorData> subColorList; // In stacking order.
+};
+
+// Paints character layers into QImages. It holds no state of its own beyond the shared ImageCache
+// (which is locked internally), so one compositor can be used from any number of threads at once,
+// and without a GUI (QCoreApplication is enough, as nothing here needs a windowing system).
+// GraphicsDisplay paints its scene layers through layer().
+class CharacterCompositor
+{
+public:
+	CharacterCompositor(ImageCache &imageCache);
+	QImage layer(const recolorJobData &job) const;
+
+private:
+	ImageCache &imageCache;
+};
@@ -0,0 +1,484 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "CharacterFile.h"
+
+namespace
+{
+	// QStringView only gets indexOf in Qt 5.14, so these stand in for it.
+	int indexOf(QStringView text, const QChar ch, const int from = 0)
+	{
+		for (int i = from; i < text.size(); i++)
+		{
+			if (text[i] == ch)
+				return i;
+		}
+		return -1;
+	}
+
+	int indexOf(QStringView text, QStringView needle, const int from = 0)
+	{
+		for (int i = from; i + needle.size() <= text.size(); i++)
+		{
+			if (text.mid(i, needle.size()) == needle)
+				return i;
+		}
+		return -1;
+	}
+
+	// Text between the end of begin and the start of end (or the end of text, if end is empty).
+	// Empty if begin isn't there.
+	QStringView between(QStringView text, QStringView begin, QStringView end)
+	{
+		const int posBegin = indexOf(text, begin);
+		if (posBegin < 0)
+			return QStringView();
+		const int from = posBegin + begin.size();
+		const int posEnd = end.isEmpty() ? text.size() : indexOf(text, end, from);
+		return text.mid(from, (posEnd < 0 ? text.size() : posEnd) - from);
+	}
+
+	int hexDigit(const QChar ch)
+	{
+		const ushort c = ch.unicode();
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+		return -1;
+	}
+}
+
+bool CharacterFile::read(const QString &filePath, characterFileData &character)
+{
+	QFile fileRead(filePath);
+	if (!fileRead.open(QIODevice::ReadOnly))
+		return false;
+	const QByteArray bytes = fileRead.readAll();
+	fileRead.close();
+
+	if (isBinary(bytes))
+		return fromBinary(bytes, character);
+
+	// Text is decoded the same way saves are written (QTextStream), in one go, then parsed from memory.
+	QTextStream qStream(bytes);
+	character = parse(qStream.readAll());
+	return true;
+}
+
+bool CharacterFile::write(const QString &filePath, const characterFileData &character)
+{
+	QSaveFile fileWrite(filePath);
+	if (!fileWrite.open(QIODevice::WriteOnly))
+		return false;
+
+	if (filePath.endsWith(QString(".") + binarySuffix, Qt::CaseInsensitive))
+		fileWrite.write(toBinary(character));
+	else
+	{
+		QTextStream qStream(&fileWrite);
+		qStream << toText(character);
+		qStream.flush();
+	}
+	return fileWrite.commit();
+}
+
+characterFileData CharacterFile::parse(QStringView contents)
+{
+	// Keys are views onto string literals, so the hash never allocates per lookup.
+	// Anything not listed is a component line or a plain field (see parseComponentOrField).
+	// The species/gender/pose line has no key of its own ("::Species=...::Gender=...::Pose=...::"), so it's picked out by its prefix.
+	static const QHash<QStringView, lineHandler> handlerMap =
+	{
+		{ QStringView(u"backgroundColor"), &CharacterFile::parseBackgroundColor },
+		{ QStringView(u"backgroundImage"), &CharacterFile::parseBackgroundImage },
+	};
+
+	characterFileData character;
+	int lineBegin = 0;
+	while (lineBegin < contents.size())
+	{
+		int lineEnd = indexOf(contents, QChar('\n'), lineBegin);
+		if (lineEnd < 0)
+			lineEnd = contents.size();
+		QStringView line = contents.mid(lineBegin, lineEnd - lineBegin);
+		lineBegin = lineEnd + 1;
+		if (line.endsWith(QChar('\r')))
+			line.chop(1);
+		if (line.isEmpty())
+			continue;
+
+		if (line.startsWith(QStringView(u"::")))
+		{
+			parseSpeciesGenderPose(QStringView(), line, character);
+			continue;
+		}
+
+		const int posEquals = indexOf(line, QChar('='));
+		if (posEquals < 0)
+			continue;
+		const QStringView key = line.left(posEquals);
+		const QStringView value = line.mid(posEquals + 1);
+		handlerMap.value(key, &CharacterFile::parseComponentOrField)(key, value, character);
+	}
+	return character;
+}
+
+// "::Species=Human::Gender=Female::Pose=Front Facing::" (the whole line is passed as value).
+void CharacterFile::parseSpeciesGenderPose(QStringView key, QStringView value, characterFileData &character)
+{
+	Q_UNUSED(key);
+	if (indexOf(value, QStringView(u"::Species=")) < 0 ||
+		indexOf(value, QStringView(u"::Gender=")) < 0 ||
+		indexOf(value, QStringView(u"::Pose=")) < 0)
+		return;
+	character.hasSpeciesGenderPose = true;
+	character.speciesStr = between(value, QStringView(u"::Species="), QStringView(u"::")).toString();
+	character.genderStr = between(value, QStringView(u"::Gender="), QStringView(u"::")).toString();
+	character.poseStr = between(value, QStringView(u"::Pose="), QStringView(u"::")).toString();
+}
+
+void CharacterFile::parseBackgroundColor(QStringView key, QStringView value, characterFileData &character)
+{
+	Q_UNUSED(key);
+	character.hasBackgroundColor = true;
+	character.backgroundColor = parseColor(value);
+}
+
+void CharacterFile::parseBackgroundImage(QStringView key, QStringView value, characterFileData &character)
+{
+	Q_UNUSED(key);
+	character.hasBackgroundImage = true;
+	character.backgroundImage = value.toString();
+}
+
+void CharacterFile::parseComponentOrField(QStringView key, QStringView value, characterFileData &character)
+{
+	const QStringView singleTag = QStringView(u"[Single]");
+	const QStringView combinedTag = QStringView(u"[Combined]");
+	const QStringView partsTag = QStringView(u"[Parts]=");
+
+	if (value.startsWith(singleTag))
+	{
+		const QStringView fields = value.mid(singleTag.size());
+		const int posComma = indexOf(fields, QChar(','));
+		characterFileComponentData component;
+		component.assetStr = key.toString();
+		component.imgFilename = fields.left(posComma < 0 ? fields.size() : posComma).toString();
+		component.color = parseColor(posComma < 0 ? QStringView() : fields.mid(posComma + 1));
+		character.componentList.emplace_back(std::move(component));
+	}
+	else if (value.startsWith(combinedTag))
+	{
+		const QStringView fields = value.mid(combinedTag.size());
+		const int posComma = indexOf(fields, QChar(','));
+		const int posParts = indexOf(fields, partsTag, posComma < 0 ? 0 : posComma);
+		characterFileComponentData component;
+		component.assetStr = key.toString();
+		component.combined = true;
+		component.imgFilename = fields.left(posComma < 0 ? fields.size() : posComma).toString();
+		if (posComma >= 0)
+			component.color = parseColor(fields.mid(posComma + 1, (posParts < 0 ? fields.size() : posParts) - posComma - 1));
+
+		// "[file,#color][file,#color]..."
+		if (posParts >= 0)
+		{
+			const QStringView parts = fields.mid(posParts + partsTag.size());
+			int partBegin = indexOf(parts, QChar('['));
+			while (partBegin >= 0)
+			{
+				const int partEnd = indexOf(parts, QChar(']'), partBegin);
+				if (partEnd < 0)
+					break;
+				const QStringView part = parts.mid(partBegin + 1, partEnd - partBegin - 1);
+				const int partComma = indexOf(part, QChar(','));
+				if (partComma >= 0)
+					component.subColorList.emplace_back(characterFileSubColorData{ part.left(partComma).toString(), parseColor(part.mid(partComma + 1)) });
+				partBegin = indexOf(parts, QChar('['), partEnd);
+			}
+		}
+		character.componentList.emplace_back(std::move(component));
+	}
+	else
+		character.fieldList.emplace_back(key.toString(), value.toString());
+}
+
+// Saves always write colors as "#rrggbb" (QColor::name), which is decoded here without a temporary string.
+// Anything else falls back to QColor's own parsing.
+QColor CharacterFile::parseColor(QStringView text)
+{
+	if (text.size() == 7 && text[0] == QChar('#'))
+	{
+		int rgb[3];
+		bool valid = true;
+		for (int i = 0; i < 3; i++)
+		{
+			const int high = hexDigit(text[1 + i * 2]);
+			const int low = hexDigit(text[2 + i * 2]);
+			valid = valid && high >= 0 && low >= 0;
+			rgb[i] = high * 16 + low;
+		}
+		if (valid)
+			return QColor(rgb[0], rgb[1], rgb[2]);
+	}
+	return QColor(text.toString());
+}
+
+// Same layout fileSave has always written, so saves stay readable by older builds.
+QString CharacterFile::toText(const characterFileData &character)
+{
+	QString text;
+	if (character.hasSpeciesGenderPose)
+	{
+		text +=
+			"::"
+			"Species=" + character.speciesStr +
+			"::" +
+			"Gender=" + character.genderStr +
+			"::" +
+			"Pose=" + character.poseStr +
+			"::"
+			"\r\n";
+	}
+
+	for (const auto& component : character.componentList)
+	{
+		if (!component.combined)
+		{
+			text += component.assetStr +
+				"=[Single]" + component.imgFilename +
+				"," + component.color.name() + "\r\n";
+		}
+		else
+		{
+			text += component.assetStr +
+				"=[Combined]" + component.imgFilename +
+				"," + component.color.name();
+
+			text += "[Parts]=";
+			for (const auto& subColor : component.subColorList)
+				text += "[" + subColor.imgFilename + "," + subColor.color.name() + "]";
+
+			text += "\r\n";
+		}
+	}
+
+	if (character.hasBackgroundColor)
+		text += "backgroundColor=" + character.backgroundColor.name() + "\r\n";
+	if (character.hasBackgroundImage)
+		text += "backgroundImage=" + character.backgroundImage + "\r\n";
+
+	for (const auto& field : character.fieldList)
+		text += field.first + "=" + field.second + "\r\n";
+
+	return text;
+}
+
+bool CharacterFile::isBinary(const QByteArray &bytes)
+{
+	if (bytes.size() < binaryHeaderSize)
+		return false;
+	QDataStream stream(bytes);
+	quint32 magic;
+	stream >> magic;
+	return magic == binaryMagic;
+}
+
+// Header: magic, version, payload size, CRC-16 of the payload (as quint32).
+// Payload: string table, then flags, species/gender/pose, components (with sub-colors), background and fields,
+// with every string given as its index in the table. Component names, asset filenames and sub-color filenames
+// repeat a lot across a library of characters, so the table keeps each one to a single copy per file.
+QByteArray CharacterFile::toBinary(const characterFileData &character)
+{
+	QStringList stringList;
+	QHash<QString, quint32> stringIndexMap;
+	auto stringIndex = [&](const QString &str) {
+		const auto it = stringIndexMap.constFind(str);
+		if (it != stringIndexMap.constEnd())
+			return it.value();
+		const quint32 index = static_cast<quint32>(stringList.size());
+		stringList.append(str);
+		stringIndexMap.insert(str, index);
+		return index;
+	};
+
+	QByteArray body;
+	{
+		QDataStream stream(&body, QIODevice::WriteOnly);
+		stream.setVersion(QDataStream::Qt_5_12);
+
+		const quint8 flags =
+			(character.hasSpeciesGenderPose ? 1 : 0) |
+			(character.hasBackgroundColor ? 2 : 0) |
+			(character.hasBackgroundImage ? 4 : 0);
+		stream << flags;
+		stream << stringIndex(character.speciesStr) << stringIndex(character.genderStr) << stringIndex(character.poseStr);
+
+		stream << static_cast<quint32>(character.componentList.size());
+		for (const auto& component : character.componentList)
+		{
+			stream << stringIndex(component.assetStr) << static_cast<quint8>(component.combined ? 1 : 0)
+				<< stringIndex(component.imgFilename) << static_cast<quint32>(component.color.rgba());
+			stream << static_cast<quint32>(component.subColorList.size());
+			for (const auto& subColor : component.subColorList)
+				stream << stringIndex(subColor.imgFilename) << static_cast<quint32>(subColor.color.rgba());
+		}
+
+		stream << static_cast<quint32>(character.backgroundColor.rgba()) << stringIndex(character.backgroundImage);
+
+		stream << static_cast<quint32>(character.fieldList.size());
+		for (const auto& field : character.fieldList)
+			stream << stringIndex(field.first) << stringIndex(field.second);
+	}
+
+	// The string table goes first in the payload, so it's written once everything has been interned.
+	QByteArray payload;
+	{
+		QDataStream stream(&payload, QIODevice::WriteOnly);
+		stream.setVersion(QDataStream::Qt_5_12);
+		stream << static_cast<quint32>(stringList.size());
+		for (const auto& str : stringList)
+			stream << str;
+	}
+	payload.append(body);
+
+	QByteArray bytes;
+	QDataStream stream(&bytes, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_12);
+	stream << binaryMagic << binaryVersion << static_cast<quint32>(payload.size())
+		<< static_cast<quint32>(qChecksum(payload.constData(), static_cast<uint>(payload.size())));
+	bytes.append(payload);
+	return bytes;
+}
+
+bool CharacterFile::fromBinary(const QByteArray &bytes, characterFileData &character)
+{
+	character = characterFileData{};
+	if (bytes.size() < binaryHeaderSize)
+		return false;
+
+	QDataStream headerStream(bytes);
+	headerStream.setVersion(QDataStream::Qt_5_12);
+	quint32 magic;
+	quint32 version;
+	quint32 payloadSize;
+	quint32 checksum;
+	headerStream >> magic >> version >> payloadSize >> checksum;
+	if (magic != binaryMagic || version != binaryVersion || payloadSize != static_cast<quint32>(bytes.size() - binaryHeaderSize))
+		return false;
+	const QByteArray payload = QByteArray::fromRawData(bytes.constData() + binaryHeaderSize, static_cast<int>(payloadSize));
+	if (checksum != qChecksum(payload.constData(), payloadSize))
+		return false;
+
+	QDataStream stream(payload);
+	stream.setVersion(QDataStream::Qt_5_12);
+
+	// No count can be larger than the bytes left could hold, so a damaged file can't make us allocate wildly.
+	auto countFits = [&](const quint32 count, const int bytesPerItem) {
+		return stream.status() == QDataStream::Ok &&
+			static_cast<qint64>(count) * bytesPerItem <= static_cast<qint64>(payloadSize) - stream.device()->pos();
+	};
+
+	quint32 stringCount;
+	stream >> stringCount;
+	if (!countFits(stringCount, 4))
+		return false;
+	QStringList stringList;
+	stringList.reserve(static_cast<int>(stringCount));
+	for (quint32 i = 0; i < stringCount && stream.status() == QDataStream::Ok; i++)
+	{
+		QString str;
+		stream >> str;
+		stringList.append(str);
+	}
+
+	bool valid = true;
+	auto readString = [&](QString &str) {
+		quint32 index;
+		stream >> index;
+		if (index >= static_cast<quint32>(stringList.size()))
+			valid = false;
+		else
+			str = stringList[static_cast<int>(index)];
+	};
+	auto readColor = [&](QColor &color) {
+		quint32 rgba;
+		stream >> rgba;
+		color = QColor::fromRgba(rgba);
+	};
+
+	quint8 flags;
+	stream >> flags;
+	character.hasSpeciesGenderPose = (flags & 1) != 0;
+	character.hasBackgroundColor = (flags & 2) != 0;
+	character.hasBackgroundImage = (flags & 4) != 0;
+	readString(character.speciesStr);
+	readString(character.genderStr);
+	readString(character.poseStr);
+
+	quint32 componentCount;
+	stream >> componentCount;
+	if (!countFits(componentCount, 17))
+		return false;
+	character.componentList.reserve(componentCount);
+	for (quint32 i = 0; i < componentCount && valid && stream.status() == QDataStream::Ok; i++)
+	{
+		characterFileComponentData component;
+		quint8 combined;
+		readString(component.assetStr);
+		stream >> combined;
+		component.combined = combined != 0;
+		readString(component.imgFilename);
+		readColor(component.color);
+
+		quint32 subColorCount;
+		stream >> subColorCount;
+		if (!countFits(subColorCount, 8))
+			return false;
+		component.subColorList.reserve(subColorCount);
+		for (quint32 j = 0; j < subColorCount && valid && stream.status() == QDataStream::Ok; j++)
+		{
+			characterFileSubColorData subColor;
+			readString(subColor.imgFilename);
+			readColor(subColor.color);
+			component.subColorList.emplace_back(std::move(subColor));
+		}
+		character.componentList.emplace_back(std::move(component));
+	}
+
+	readColor(character.backgroundColor);
+	readString(character.backgroundImage);
+
+	quint32 fieldCount;
+	stream >> fieldCount;
+	if (!countFits(fieldCount, 8))
+		return false;
+	for (quint32 i = 0; i < fieldCount && valid && stream.status() == QDataStream::Ok; i++)
+	{
+		std::pair<QString, QString> field;
+		readString(field.first);
+		readString(field.second);
+		character.fieldList.emplace_back(std::move(field));
+	}
+
+	if (!valid || stream.status() != QDataStream::Ok)
+	{
+		character = characterFileData{};
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,97 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include <QString>
+#include <QStringView>
+#include <QColor>
+#include <QHash>
+#include <QFile>
+#include <QTextStream>
+#include <QDataStream>
+#include <QSaveFile>
+#include <QByteArray>
+#include <vector>
+#include <utility>
+
+// What a .zen2dx save (or default character template) holds, as plain data with no ties to the scene.
+// Loading is split in two: CharacterFile parses the text into this in one pass, and GraphicsDisplay applies it.
+
+struct characterFileSubColorData
+{
+	QString imgFilename;
+	QColor color;
+};
+
+// One "Head=[Single]file,#color" or "Head=[Combined]file,#color[Parts]=[file,#color]..." line.
+struct characterFileComponentData
+{
+	QString assetStr; // The component's asset folder string (ex: "Head").
+	bool combined = false;
+	QString imgFilename;
+	QColor color;
+	std::vector<characterFileSubColorData> subColorList; // Combined only.
+};
+
+struct characterFileData
+{
+	bool hasSpeciesGenderPose = false;
+	QString speciesStr;
+	QString genderStr;
+	QString poseStr;
+	std::vector<characterFileComponentData> componentList; // In file order.
+	bool hasBackgroundColor = false;
+	QColor backgroundColor;
+	bool hasBackgroundImage = false;
+	QString backgroundImage;
+	std::vector<std::pair<QString, QString>> fieldList; // Any other "key=value" line (ex: the name inputs), in file order.
+};
+
+// Reads and writes characters in two formats holding exactly the same data:
+// - .zen2dx text: human-readable, parsed by a single-pass tokenizer. Each line is split once at its first '=',
+//   and the key picks the line's handler from a hash; fields are sliced out as QStringViews over the file contents
+//   and only turned into QStrings when they're stored. So parsing is linear in file size.
+// - .zen2db binary: for storing characters in bulk (ex: generated NPCs). Every string is written once to a table
+//   and referred to by index, colors are packed RGBA, and the payload is checksummed. Decoding is a bounded walk
+//   through the buffer, with every count checked against what's left of it.
+// read() tells the two apart by the binary magic, and write() picks the format from the file extension,
+// so converting a character between them is a read and a write.
+class CharacterFile
+{
+public:
+	static bool read(const QString &filePath, characterFileData &character);
+	static bool write(const QString &filePath, const characterFileData &character);
+	static characterFileData parse(QStringView contents);
+	static QString toText(const characterFileData &character);
+	static QByteArray toBinary(const characterFileData &character);
+	static bool fromBinary(const QByteArray &bytes, characterFileData &character);
+	static bool isBinary(const QByteArray &bytes);
+
+	static constexpr const char *textSuffix = "zen2dx";
+	static constexpr const char *binarySuffix = "zen2db";
+
+private:
+	static const quint32 binaryMagic = 0x5A324443; // "Z2DC"
+	static const quint32 binaryVersion = 1; // Bump whenever the binary layout changes.
+	static const int binaryHeaderSize = 4 * 4; // Magic, version, payload size, payload checksum.
+
+	using lineHandler = void(*)(QStringView key, QStringView value, characterFileData &character);
+
+	static void parseSpeciesGenderPose(QStringView key, QStringView value, characterFileData &character);
+	static void parseBackgroundColor(QStringView key, QStringView value, characterFileData &character);
+	static void parseBackgroundImage(QStringView key, QStringView value, characterFileData &character);
+	static void parseComponentOrField(QStringView key, QStringView value, characterFileData &character);
+	static QColor parseColor(QStringView text);
+};
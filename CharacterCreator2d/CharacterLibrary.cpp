@@ -0,0 +1,410 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "CharacterLibrary.h"
+
+CharacterLibrary::~CharacterLibrary()
+{
+	close();
+}
+
+bool CharacterLibrary::open(const QString &libraryPath)
+{
+	close();
+	file.setFileName(libraryPath);
+	if (!file.open(QIODevice::ReadWrite))
+		return false;
+
+	// A new library is just a header and an empty index.
+	if (file.size() == 0)
+	{
+		file.write(headerBytes(0, 0, 0, headerSize));
+		file.write(indexBytes({ }));
+		file.flush();
+	}
+
+	map();
+	if (!readIndex())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void CharacterLibrary::close()
+{
+	unmap();
+	entryList.clear();
+	tailRecordCount = 0;
+	lastRecordOffset = 0;
+	indexOffset = 0;
+	indexSize = 0;
+	if (file.isOpen())
+		file.close();
+}
+
+std::vector<int> CharacterLibrary::search(const QString &text) const
+{
+	std::vector<int> matchList;
+	for (int i = 0; i < count(); i++)
+	{
+		if (text.isEmpty() ||
+			entryList[i].firstName.contains(text, Qt::CaseInsensitive) ||
+			entryList[i].lastName.contains(text, Qt::CaseInsensitive))
+			matchList.emplace_back(i);
+	}
+	return matchList;
+}
+
+int CharacterLibrary::find(const QString &firstName, const QString &lastName) const
+{
+	for (int i = 0; i < count(); i++)
+	{
+		if (entryList[i].firstName == firstName && entryList[i].lastName == lastName)
+			return i;
+	}
+	return -1;
+}
+
+bool CharacterLibrary::read(const int entryNum, characterFileData &character) const
+{
+	if (!mapped || entryNum < 0 || entryNum >= count())
+		return false;
+	const characterLibraryEntryData &entryAt = entryList[entryNum];
+	if (entryAt.offset > static_cast<quint64>(mappedSize) || entryAt.size > static_cast<quint64>(mappedSize) - entryAt.offset)
+		return false;
+
+	// Wraps the mapped bytes without copying them.
+	const QByteArray bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped + entryAt.offset), static_cast<int>(entryAt.size));
+	return CharacterFile::fromBinary(bytes, character);
+}
+
+int CharacterLibrary::append(const characterFileData &character)
+{
+	entryList.emplace_back(characterLibraryEntryData());
+	if (!writeEntry(static_cast<quint32>(entryList.size() - 1), character, entryList.back()))
+	{
+		entryList.pop_back();
+		return -1;
+	}
+	return count() - 1;
+}
+
+bool CharacterLibrary::update(const int entryNum, const characterFileData &character)
+{
+	if (entryNum < 0 || entryNum >= count())
+		return false;
+	return writeEntry(static_cast<quint32>(entryNum), character, entryList[entryNum]);
+}
+
+qint64 CharacterLibrary::deadSize() const
+{
+	if (!file.isOpen())
+		return 0;
+	qint64 liveSize = headerSize + indexSize;
+	for (const auto& entryAt : entryList)
+		liveSize += static_cast<qint64>(entryAt.offset - entryAt.recordOffset) + entryAt.size;
+	return std::max(qint64(0), file.size() - liveSize);
+}
+
+// Writes every live record, in entry order, then an index of them, to a new file that only replaces
+// the library once it's complete. The blobs are copied straight from the mapping, without decoding them.
+bool CharacterLibrary::compact()
+{
+	if (!mapped)
+		return false;
+
+	const QString libraryPath = path();
+	QSaveFile fileWrite(libraryPath);
+	if (!fileWrite.open(QIODevice::WriteOnly))
+		return false;
+
+	// The header is written first to reserve its space, then again once the index's offset is known.
+	const quint32 entryCount = static_cast<quint32>(entryList.size());
+	bool written = fileWrite.write(headerBytes(entryCount, 0, 0, 0)) == headerSize;
+	std::vector<characterLibraryEntryData> entryListNew;
+	entryListNew.reserve(entryList.size());
+	quint64 recordOffset = headerSize;
+	quint64 prevRecordOffset = 0;
+	for (quint32 i = 0; i < entryCount && written; i++)
+	{
+		const characterLibraryEntryData &entryAt = entryList[i];
+		const QByteArray recordHeader = recordHeaderBytes(prevRecordOffset, i, entryAt);
+		written =
+			fileWrite.write(recordHeader) == recordHeader.size() &&
+			fileWrite.write(reinterpret_cast<const char*>(mapped + entryAt.offset), entryAt.size) == static_cast<qint64>(entryAt.size);
+
+		characterLibraryEntryData entryNew = entryAt;
+		entryNew.recordOffset = recordOffset;
+		entryNew.offset = recordOffset + static_cast<quint64>(recordHeader.size());
+		entryListNew.emplace_back(std::move(entryNew));
+		prevRecordOffset = recordOffset;
+		recordOffset += static_cast<quint64>(recordHeader.size()) + entryAt.size;
+	}
+	const QByteArray index = indexBytes(entryListNew);
+	written = written &&
+		fileWrite.write(index) == index.size() &&
+		fileWrite.seek(0) &&
+		fileWrite.write(headerBytes(entryCount, 0, prevRecordOffset, recordOffset)) == headerSize;
+	if (!written)
+	{
+		fileWrite.cancelWriting();
+		return false;
+	}
+
+	// The library has to be closed (and unmapped) before the new file can take its place.
+	close();
+	const bool committed = fileWrite.commit();
+	return open(libraryPath) && committed;
+}
+
+// Builds entryList from the index the header points at, then the tail of records written after it.
+// Every offset and size is checked against the mapping on its own before it's used, entries in the index must
+// sit wholly before it, and each tail record must sit after the index and wholly before the record that points
+// at it, so a corrupt file can't read out of bounds or send the walk around in a loop.
+bool CharacterLibrary::readIndex()
+{
+	entryList.clear();
+	if (!mapped || mappedSize < headerSize)
+		return false;
+
+	const QByteArray headerData = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), headerSize);
+	QDataStream headerStream(headerData);
+	headerStream.setVersion(QDataStream::Qt_5_12);
+	quint32 magic;
+	quint32 version;
+	quint32 entryCount;
+	quint32 tailRecordCountRead;
+	quint64 lastRecordOffsetRead;
+	quint64 indexOffsetRead;
+	headerStream >> magic >> version >> entryCount >> tailRecordCountRead >> lastRecordOffsetRead >> indexOffsetRead;
+	if (magic != libraryMagic || version != libraryVersion)
+		return false;
+
+	const quint64 fileSize = static_cast<quint64>(mappedSize);
+	if (indexOffsetRead < static_cast<quint64>(headerSize) || indexOffsetRead >= fileSize)
+		return false;
+
+	// The index.
+	const quint64 indexAvailable = std::min<quint64>(fileSize - indexOffsetRead, static_cast<quint64>(std::numeric_limits<int>::max()));
+	const QByteArray indexData = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped + indexOffsetRead), static_cast<int>(indexAvailable));
+	QDataStream indexStream(indexData);
+	indexStream.setVersion(QDataStream::Qt_5_12);
+	quint32 indexMagicRead;
+	quint32 indexCount;
+	indexStream >> indexMagicRead >> indexCount;
+	// Record offset, blob offset, blob size and the lengths of two empty names.
+	const quint64 indexEntrySizeMin = 8 + 8 + 4 + 4 + 4;
+	if (indexStream.status() != QDataStream::Ok || indexMagicRead != indexMagic ||
+		indexCount > entryCount || indexCount > indexAvailable / indexEntrySizeMin)
+		return false;
+
+	std::vector<characterLibraryEntryData> entryListRead(entryCount);
+	for (quint32 i = 0; i < indexCount; i++)
+	{
+		characterLibraryEntryData &entryAt = entryListRead[i];
+		indexStream >> entryAt.recordOffset >> entryAt.offset >> entryAt.size >> entryAt.firstName >> entryAt.lastName;
+		if (indexStream.status() != QDataStream::Ok ||
+			entryAt.recordOffset < static_cast<quint64>(headerSize) || entryAt.offset < entryAt.recordOffset ||
+			entryAt.offset > indexOffsetRead || entryAt.size > indexOffsetRead - entryAt.offset)
+			return false;
+	}
+	const quint64 indexEnd = indexOffsetRead + static_cast<quint64>(indexStream.device()->pos());
+
+	// The tail. Magic, previous record offset, entry number, blob size and the lengths of two empty names.
+	const quint64 recordSizeMin = 4 + 8 + 4 + 4 + 4 + 4;
+	if (tailRecordCountRead > (fileSize - indexEnd) / recordSizeMin || entryCount - indexCount > tailRecordCountRead)
+		return false;
+
+	std::vector<bool> seenList(entryCount, false);
+	quint64 recordOffset = lastRecordOffsetRead;
+	quint64 recordLimit = fileSize;
+	for (quint32 i = 0; i < tailRecordCountRead; i++)
+	{
+		if (recordOffset < indexEnd || recordOffset >= recordLimit)
+			return false;
+		const quint64 available = std::min<quint64>(recordLimit - recordOffset, static_cast<quint64>(std::numeric_limits<int>::max()));
+		const QByteArray recordBytes = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped + recordOffset), static_cast<int>(available));
+		QDataStream stream(recordBytes);
+		stream.setVersion(QDataStream::Qt_5_12);
+		quint32 recordMagicRead;
+		quint64 prevRecordOffset;
+		quint32 entryNum;
+		characterLibraryEntryData entryAt;
+		stream >> recordMagicRead >> prevRecordOffset >> entryNum >> entryAt.size >> entryAt.firstName >> entryAt.lastName;
+		if (stream.status() != QDataStream::Ok || recordMagicRead != recordMagic || entryNum >= entryCount)
+			return false;
+		const quint64 recordHeaderSize = static_cast<quint64>(stream.device()->pos());
+		if (entryAt.size > available - recordHeaderSize)
+			return false;
+
+		// Walking back from the newest record, so the first record met for an entry is its current one.
+		if (!seenList[entryNum])
+		{
+			entryAt.recordOffset = recordOffset;
+			entryAt.offset = recordOffset + recordHeaderSize;
+			entryListRead[entryNum] = std::move(entryAt);
+			seenList[entryNum] = true;
+		}
+		recordLimit = recordOffset;
+		recordOffset = prevRecordOffset;
+	}
+
+	// Entries past the index only exist through the tail.
+	if (std::find(seenList.begin() + indexCount, seenList.end(), false) != seenList.end())
+		return false;
+
+	entryList = std::move(entryListRead);
+	tailRecordCount = tailRecordCountRead;
+	lastRecordOffset = lastRecordOffsetRead;
+	indexOffset = indexOffsetRead;
+	indexSize = static_cast<qint64>(indexEnd - indexOffsetRead);
+	return true;
+}
+
+// Appends one record (header and blob) for the entry after the current end of the file, and only then
+// points the header at it. entry is only filled in (offsets, size, names) once both are written.
+// If that makes the tail long enough, a fresh index is written after it.
+bool CharacterLibrary::writeEntry(const quint32 entryNum, const characterFileData &character, characterLibraryEntryData &entry)
+{
+	if (!file.isOpen())
+		return false;
+
+	const QByteArray blob = CharacterFile::toBinary(character);
+	characterLibraryEntryData entryNew = entryFor(character);
+	entryNew.size = static_cast<quint32>(blob.size());
+	const QByteArray recordHeader = recordHeaderBytes(lastRecordOffset, entryNum, entryNew);
+
+	// The mapping covers the file as it was, so it's dropped while the file grows.
+	unmap();
+
+	const qint64 recordOffset = file.size();
+	entryNew.recordOffset = static_cast<quint64>(recordOffset);
+	entryNew.offset = static_cast<quint64>(recordOffset + recordHeader.size());
+	const quint32 entryCount = std::max(static_cast<quint32>(entryList.size()), entryNum + 1);
+
+	bool written =
+		file.seek(recordOffset) &&
+		file.write(recordHeader) == recordHeader.size() &&
+		file.write(blob) == blob.size() &&
+		file.flush();
+	if (written)
+	{
+		const QByteArray header = headerBytes(entryCount, tailRecordCount + 1, static_cast<quint64>(recordOffset), indexOffset);
+		written = file.seek(0) && file.write(header) == header.size() && file.flush();
+	}
+	if (written)
+	{
+		entry = std::move(entryNew);
+		tailRecordCount++;
+		lastRecordOffset = static_cast<quint64>(recordOffset);
+
+		// The tail may grow with the library, so the index is rewritten a fixed number of times per doubling
+		// and its cost stays constant per write, spread out.
+		if (tailRecordCount >= std::max(tailRecordCountMin, entryCount / 8))
+			writeIndex();
+	}
+
+	map();
+	return written;
+}
+
+// Appends an index of every entry as it is now after the end of the file, then points the header at it
+// with an empty tail. The old index is left behind as dead bytes. If this fails, the header still points
+// at the old index and tail, which are as valid as before.
+bool CharacterLibrary::writeIndex()
+{
+	unmap();
+	const qint64 indexOffsetNew = file.size();
+	const QByteArray index = indexBytes(entryList);
+	bool written =
+		file.seek(indexOffsetNew) &&
+		file.write(index) == index.size() &&
+		file.flush();
+	if (written)
+	{
+		const QByteArray header = headerBytes(static_cast<quint32>(entryList.size()), 0, lastRecordOffset, static_cast<quint64>(indexOffsetNew));
+		written = file.seek(0) && file.write(header) == header.size() && file.flush();
+	}
+	if (written)
+	{
+		tailRecordCount = 0;
+		indexOffset = static_cast<quint64>(indexOffsetNew);
+		indexSize = index.size();
+	}
+	map();
+	return written;
+}
+
+void CharacterLibrary::map()
+{
+	unmap();
+	mappedSize = file.size();
+	if (mappedSize > 0)
+		mapped = file.map(0, mappedSize);
+	if (!mapped)
+		mappedSize = 0;
+}
+
+void CharacterLibrary::unmap()
+{
+	if (mapped)
+		file.unmap(mapped);
+	mapped = nullptr;
+	mappedSize = 0;
+}
+
+QByteArray CharacterLibrary::headerBytes(const quint32 entryCount, const quint32 tailRecordCount, const quint64 lastRecordOffset, const quint64 indexOffset)
+{
+	QByteArray bytes;
+	QDataStream stream(&bytes, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_12);
+	stream << libraryMagic << libraryVersion << entryCount << tailRecordCount << lastRecordOffset << indexOffset;
+	return bytes;
+}
+
+QByteArray CharacterLibrary::indexBytes(const std::vector<characterLibraryEntryData> &entryList)
+{
+	QByteArray bytes;
+	QDataStream stream(&bytes, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_12);
+	stream << indexMagic << static_cast<quint32>(entryList.size());
+	for (const auto& entryAt : entryList)
+		stream << entryAt.recordOffset << entryAt.offset << entryAt.size << entryAt.firstName << entryAt.lastName;
+	return bytes;
+}
+
+QByteArray CharacterLibrary::recordHeaderBytes(const quint64 prevRecordOffset, const quint32 entryNum, const characterLibraryEntryData &entry)
+{
+	QByteArray bytes;
+	QDataStream stream(&bytes, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_12);
+	stream << recordMagic << prevRecordOffset << entryNum << entry.size << entry.firstName << entry.lastName;
+	return bytes;
+}
+
+characterLibraryEntryData CharacterLibrary::entryFor(const characterFileData &character)
+{
+	characterLibraryEntryData entryNew;
+	for (const auto& field : character.fieldList)
+	{
+		if (field.first == firstNameField)
+			entryNew.firstName = field.second;
+		else if (field.first == lastNameField)
+			entryNew.lastName = field.second;
+	}
+	return entryNew;
+}
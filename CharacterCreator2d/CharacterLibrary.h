@@ -0,0 +1,102 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "CharacterFile.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+// Where one character sits in the library, plus the name fields it can be searched by.
+struct characterLibraryEntryData
+{
+	quint64 recordOffset = 0; // Start of the record holding this version of the entry.
+	quint64 offset = 0; // Start of the character's blob (just past the record header).
+	quint32 size = 0;
+	QString firstName;
+	QString lastName;
+};
+
+// Many characters in one .zen2dlib file, for rosters too big to keep as a file per character (ex: generated NPCs).
+// Layout:
+//   Header (fixed size): magic, version, entry count, tail record count, offset of the last record, offset of the index.
+//   Records: a record header (magic, offset of the record before it, entry number, blob size, first name, last name),
+//   then the character as a CharacterFile binary blob.
+//   Index: magic, entry count, then per entry the offsets and size of its current record and its name fields,
+//   for every entry that was in the library when the index was written.
+// Appending or updating writes one record at the end of the file and then the header, so a write costs the same
+// however big the library is, and a write cut short leaves the header on the previous, intact state.
+// Records written since the index (the tail) are chained back from the header; an update appends a new record
+// for the same entry number, and the newest record for an entry wins. Once the tail gets long compared to the
+// library, a fresh index is appended after it and the header repointed there, so opening only ever reads the header,
+// one index and a short tail, however many records the file holds.
+// The file is memory-mapped while open, so listing and searching only touch that in-memory index,
+// and opening an entry decodes just that entry's bytes straight from the mapping.
+// Replaced records and old indexes stay in the file as dead bytes until compact() rewrites it with only live ones.
+class CharacterLibrary
+{
+public:
+	~CharacterLibrary();
+	bool open(const QString &libraryPath); // Creates the library if it doesn't exist yet.
+	void close();
+	bool isOpen() const { return file.isOpen(); }
+	QString path() const { return file.fileName(); }
+
+	int count() const { return static_cast<int>(entryList.size()); }
+	const characterLibraryEntryData& entry(const int entryNum) const { return entryList[entryNum]; }
+	std::vector<int> search(const QString &text) const; // Entries whose first or last name contains text (all, if empty).
+	int find(const QString &firstName, const QString &lastName) const; // -1 if there's no such entry.
+
+	bool read(const int entryNum, characterFileData &character) const;
+	int append(const characterFileData &character); // Returns the new entry's number, or -1 if it couldn't be written.
+	bool update(const int entryNum, const characterFileData &character);
+
+	qint64 deadSize() const; // Bytes held by records that have since been replaced, and by old indexes.
+	bool compact(); // Rewrites the library with just the live records and one index. Entry numbers are kept.
+
+	static constexpr const char *suffix = "zen2dlib";
+	static constexpr const char *firstNameField = "characterFirstName";
+	static constexpr const char *lastNameField = "characterLastName";
+
+private:
+	QFile file;
+	uchar *mapped = nullptr;
+	qint64 mappedSize = 0;
+	std::vector<characterLibraryEntryData> entryList;
+	quint32 tailRecordCount = 0; // Records written since the index.
+	quint64 lastRecordOffset = 0; // 0 when there are no records yet.
+	quint64 indexOffset = 0;
+	qint64 indexSize = 0;
+
+	static const quint32 libraryMagic = 0x5A32444C; // "Z2DL"
+	static const quint32 libraryVersion = 3; // Bump whenever the layout changes.
+	static const quint32 recordMagic = 0x5A324452; // "Z2DR"
+	static const quint32 indexMagic = 0x5A324449; // "Z2DI"
+	static const int headerSize = 4 * 4 + 8 * 2; // Magic, version, entry count, tail record count, last record offset, index offset.
+	static constexpr quint32 tailRecordCountMin = 64; // The tail may always grow this long before a new index is written.
+
+	bool readIndex();
+	bool writeEntry(const quint32 entryNum, const characterFileData &character, characterLibraryEntryData &entry);
+	bool writeIndex();
+	void map();
+	void unmap();
+	static QByteArray headerBytes(const quint32 entryCount, const quint32 tailRecordCount, const quint64 lastRecordOffset, const quint64 indexOffset);
+	static QByteArray indexBytes(const std::vector<characterLibraryEntryData> &entryList);
+	static QByteArray recordHeaderBytes(const quint64 prevRecordOffset, const quint32 entryNum, const characterLibraryEntryData &entry);
+	static characterLibraryEntryData entryFor(const characterFileData &character);
+};
@@ -0,0 +1,73 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "CharacterRules.h"
+
+// Works out everything a component's color flows on to. An edge comes from either side declaring it
+// (a Sub list entry on the source, or a Dom list entry on the follower), so the two lists don't have to
+// be kept mirrored by hand. The result is the depth-first reverse postorder of what's reachable, which puts
+// every component after the ones it's bound through. A cycle in the settings is cut where it closes,
+// rather than bouncing a color around forever.
+std::vector<ComponentType> CharacterRules::sharedColoringBoundList(const std::map<ComponentType, componentDataSettings> &componentMap, const ComponentType &component)
+{
+	std::array<std::vector<ComponentType>, componentTypeCount> edgeList;
+	auto addEdge = [&](const ComponentType &from, const ComponentType &to) {
+		auto& edges = edgeList[static_cast<std::size_t>(from)];
+		if (from != to && std::find(edges.begin(), edges.end(), to) == edges.end())
+			edges.emplace_back(to);
+	};
+	for (const auto& componentSettings : componentMap)
+	{
+		for (const auto& sub : componentSettings.second.sharedColoringSubList)
+			addEdge(componentSettings.first, sub);
+		for (const auto& dom : componentSettings.second.sharedColoringDomList)
+			addEdge(dom, componentSettings.first);
+	}
+
+	std::array<bool, componentTypeCount> visited{};
+	std::vector<ComponentType> postorder;
+	std::function<void(const ComponentType&)> visit = [&](const ComponentType &type) {
+		visited[static_cast<std::size_t>(type)] = true;
+		for (const auto& next : edgeList[static_cast<std::size_t>(type)])
+		{
+			if (!visited[static_cast<std::size_t>(next)])
+				visit(next);
+		}
+		postorder.emplace_back(type);
+	};
+	visit(component);
+	postorder.pop_back(); // The component itself finishes last.
+
+	std::vector<ComponentType> boundList;
+	for (auto it = postorder.rbegin(); it != postorder.rend(); ++it)
+	{
+		// Only components the species actually has can be colored.
+		if (componentMap.count(*it) > 0)
+			boundList.emplace_back(*it);
+	}
+	return boundList;
+}
+
+// Every layer of the asset (still or animated) is cropped to the same rect, so a layer's offset
+// never has to change between frames.
+QRect CharacterRules::alphaBounds(const assetIndexAssetData &asset)
+{
+	QRect bounds = asset.imgFillBounds.united(asset.imgOutlineBounds);
+	for (const auto& subColorIndex : asset.subColorList)
+		bounds = bounds.united(subColorIndex.imgBounds);
+	for (const auto& frame : asset.animation.frameList)
+		bounds = bounds.united(frame.imgOutlineBounds).united(frame.imgFillBounds);
+	return bounds;
+}
@@ -0,0 +1,33 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "theme.h"
+#include "AssetScanner.h"
+#include <QRect>
+#include <map>
+#include <vector>
+#include <array>
+#include <functional>
+#include <algorithm>
+
+// Character rules worked out from the component settings and the asset index alone, with no widgets involved,
+// so anything that builds or paints characters (the creator, CharacterCompositor) follows the same ones.
+class CharacterRules
+{
+public:
+	static std::vector<ComponentType> sharedColoringBoundList(const std::map<ComponentType, componentDataSettings> &componentMap, const ComponentType &component);
+	static QRect alphaBounds(const assetIndexAssetData &asset);
+};
@@ -0,0 +1,213 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "StringInterner.h"
+#include <QString>
+#include <QHash>
+#include <QtGlobal>
+#include <array>
+#include <vector>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+// Contiguous replacements for the std::maps the character model used to be built from.
+// Both keep the parts of the std::map interface the rest of the code leans on (at, count, try_emplace,
+// and iteration over {first, second} pairs in key order), so call sites read the same.
+// Neither ever moves an element once it's in (EnumTable's slots are fixed, InternedTable's entries are in a deque),
+// so references (and lambdas capturing them) stay valid as more are added.
+
+// Table keyed by a small enum whose values run 0..N-1. Lookups are a plain array index.
+template<typename Key, typename T, std::size_t N>
+class EnumTable
+{
+public:
+	using value_type = std::pair<const Key, T>;
+
+	template<typename Slots, typename Value>
+	class iteratorBase
+	{
+	public:
+		iteratorBase(Slots *tableSlots, std::size_t index)
+			: tableSlots(tableSlots), index(index)
+		{
+			skipEmpty();
+		}
+		Value& operator*() const { return *(*tableSlots)[index]; }
+		Value* operator->() const { return &*(*tableSlots)[index]; }
+		iteratorBase& operator++() { index++; skipEmpty(); return *this; }
+		bool operator==(const iteratorBase &other) const { return index == other.index; }
+		bool operator!=(const iteratorBase &other) const { return index != other.index; }
+
+	private:
+		Slots *tableSlots;
+		std::size_t index;
+
+		void skipEmpty()
+		{
+			while (index < N && !(*tableSlots)[index])
+				index++;
+		}
+	};
+
+	using slotArray = std::array<std::optional<value_type>, N>;
+	using iterator = iteratorBase<slotArray, value_type>;
+	using const_iterator = iteratorBase<const slotArray, const value_type>;
+
+	iterator begin() { return iterator(&tableSlots, 0); }
+	iterator end() { return iterator(&tableSlots, N); }
+	const_iterator begin() const { return const_iterator(&tableSlots, 0); }
+	const_iterator end() const { return const_iterator(&tableSlots, N); }
+
+	// Throws std::out_of_range for keys that were never added, same as std::map.
+	T& at(const Key &key)
+	{
+		const std::size_t index = static_cast<std::size_t>(key);
+		if (index >= N || !tableSlots[index])
+			throw std::out_of_range("EnumTable::at");
+		return tableSlots[index]->second;
+	}
+
+	const T& at(const Key &key) const
+	{
+		return const_cast<EnumTable*>(this)->at(key);
+	}
+
+	std::size_t count(const Key &key) const
+	{
+		const std::size_t index = static_cast<std::size_t>(key);
+		return index < N && tableSlots[index] ? 1 : 0;
+	}
+
+	std::pair<iterator, bool> try_emplace(const Key &key, T &&value)
+	{
+		const std::size_t index = static_cast<std::size_t>(key);
+		Q_ASSERT(index < N);
+		const bool inserted = !tableSlots[index];
+		if (inserted)
+			tableSlots[index].emplace(key, std::move(value));
+		return { iterator(&tableSlots, index), inserted };
+	}
+
+	std::size_t size() const
+	{
+		return static_cast<std::size_t>(std::count_if(tableSlots.begin(), tableSlots.end(), [](const auto &slot) { return slot.has_value(); }));
+	}
+
+	bool empty() const { return size() == 0; }
+
+private:
+	slotArray tableSlots;
+};
+
+// Table keyed by interned name ID (ex: asset folder names, see StringInterner). Elements sit in one deque
+// in the order they were added (so adding more never moves them), with a hash from ID to position for lookups, and iteration goes through a separate
+// order sorted by name so it matches what std::map<QString, ...> gave us (the first asset alphabetically is
+// still the default, sub-colors stack in name order, etc.).
+template<typename T>
+class InternedTable
+{
+public:
+	using value_type = std::pair<const int, T>;
+
+	template<typename Entries, typename Value>
+	class iteratorBase
+	{
+	public:
+		iteratorBase(Entries *entries, std::vector<int>::const_iterator orderIt)
+			: entries(entries), orderIt(orderIt)
+		{
+
+		}
+		Value& operator*() const { return (*entries)[*orderIt]; }
+		Value* operator->() const { return &(*entries)[*orderIt]; }
+		iteratorBase& operator++() { ++orderIt; return *this; }
+		bool operator==(const iteratorBase &other) const { return orderIt == other.orderIt; }
+		bool operator!=(const iteratorBase &other) const { return orderIt != other.orderIt; }
+
+	private:
+		Entries *entries;
+		std::vector<int>::const_iterator orderIt;
+	};
+
+	using iterator = iteratorBase<std::deque<value_type>, value_type>;
+	using const_iterator = iteratorBase<const std::deque<value_type>, const value_type>;
+
+	iterator begin() { return iterator(&entries, order.cbegin()); }
+	iterator end() { return iterator(&entries, order.cend()); }
+	const_iterator begin() const { return const_iterator(&entries, order.cbegin()); }
+	const_iterator end() const { return const_iterator(&entries, order.cend()); }
+
+	void reserve(const std::size_t capacity)
+	{
+		order.reserve(capacity);
+	}
+
+	// Throws std::out_of_range for IDs that were never added, same as std::map.
+	T& at(const int id)
+	{
+		const int index = slotMap.value(id, -1);
+		if (index < 0)
+			throw std::out_of_range("InternedTable::at");
+		return entries[index].second;
+	}
+
+	const T& at(const int id) const
+	{
+		return const_cast<InternedTable*>(this)->at(id);
+	}
+
+	std::size_t count(const int id) const
+	{
+		return slotMap.contains(id) ? 1 : 0;
+	}
+
+	// The element's place in the name order is found by binary search, and the returned iterator is built
+	// straight from it, so adding n elements costs n log n name comparisons. Making room in the order is
+	// a memmove of ints, and free when elements arrive in name order.
+	std::pair<iterator, bool> try_emplace(const int id, T &&value)
+	{
+		const int existing = slotMap.value(id, -1);
+		if (existing >= 0)
+			return { iterator(&entries, orderPosition(id)), false };
+
+		const int index = static_cast<int>(entries.size());
+		const auto orderIt = orderPosition(id);
+		entries.emplace_back(id, std::move(value));
+		slotMap.insert(id, index);
+		return { iterator(&entries, order.insert(orderIt, index)), true };
+	}
+
+	std::size_t size() const { return entries.size(); }
+	bool empty() const { return entries.empty(); }
+
+private:
+	std::deque<value_type> entries;
+	std::vector<int> order; // Indexes into entries, sorted by name.
+	QHash<int, int> slotMap; // ID -> index into entries.
+
+	// Where the element with this ID is (or would go) in order. IDs are unique per name, so it's the first
+	// element whose name isn't less than the ID's name.
+	std::vector<int>::const_iterator orderPosition(const int id) const
+	{
+		const QString &name = internedNames().str(id);
+		return std::lower_bound(order.cbegin(), order.cend(), name, [this](const int lhs, const QString &rhs) {
+			return internedNames().str(entries[lhs].first) < rhs;
+		});
+	}
+};
@@ -50,6 +50,9 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 	contextMenu.get()->addAction(actionFileSave.get());
 	contextMenu.get()->addAction(actionFileRender.get());
 	contextMenu.get()->addSeparator();
+	contextMenu.get()->addAction(actionLibraryOpen.get());
+	contextMenu.get()->addAction(actionLibrarySave.get());
+	contextMenu.get()->addSeparator();
 	contextMenu.get()->addAction(actionSetBackgroundColor.get());
 	contextMenu.get()->addAction(actionSetBackgroundImage.get());
 	contextMenu.get()->addAction(actionClearBackgroundImage.get());
@@ -73,6 +76,14 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 			setCharacterModified(false);
 	});
 	connect(actionFileRender.get(), &QAction::triggered, this, &GraphicsDisplay::fileRenderCharacter);
+	connect(actionLibraryOpen.get(), &QAction::triggered, this, [=]() {
+		if (fileSaveModifCheck())
+			libraryOpenCharacter();
+	});
+	connect(actionLibrarySave.get(), &QAction::triggered, this, [=]() {
+		if (librarySaveCharacter())
+			setCharacterModified(false);
+	});
 	connect(actionSetBackgroundColor.get(), &QAction::triggered, this, [=]() {
 		QColor colorNew = QColorDialog::getColor(backgroundColor, this->parentWidget(), "Choose Color");
 		if (colorNew.isValid())
@@ -161,216 +172,65 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 	// species->uiComponent
 
 	// Create nested maps and data structures first.
+	// Poses start out as stubs (no components/assets yet). Their contents and widgets
+	// are built from assetIndex the first time they're used (see materializePose).
 	for (const auto& species : speciesTypeMap)
 	{
 		speciesMap.try_emplace(species.first, speciesData{ species.second.assetStr });
 		for (const auto& componentSettings : species.second.componentMapRef)
-			speciesMap.at(species.first).componentUiMap.try_emplace(componentSettings.first, componentUiData{ componentSettings.second });
+		{
+			speciesMap.at(species.first).componentUiMap.try_emplace
+			(
+				componentSettings.first,
+				componentUiData{ componentSettings.second, internedNames().intern(componentSettings.second.assetStr) }
+			);
+			speciesMap.at(species.first).componentByAssetStrId.insert(internedNames().id(componentSettings.second.assetStr), componentSettings.first);
+		}
+		buildSharedColoringGraph(speciesMap.at(species.first), species.second.componentMapRef);
 		for (const auto& gender : genderTypeMap)
 		{
 			speciesMap.at(species.first).genderMap.try_emplace(gender.first, genderData{ gender.second });
 			for (const auto& pose : poseTypeMap)
-			{
 				speciesMap.at(species.first).genderMap.at(gender.first).poseMap.try_emplace(pose.first, poseData{ pose.second });
+		}
+	}
 
-				// We design override list to only be relevant if one is found and contains applicable overrides. 
-				// Otherwise, default order list is used for any given pose.
-				QStringList displayOrderOverrideList;
-				QString displayOrderOverridePath =
-					appExecutablePath +
-					"/Assets/Species/" +
-					species.second.assetStr + "/" +
-					gender.second + "/" +
-					pose.second + "/" +
-					"displayOrderOverride.txt";
-				if (QFile(displayOrderOverridePath).exists())
-				{
-					QFile fileRead(displayOrderOverridePath);
-					if (fileRead.open(QIODevice::ReadOnly))
-					{
-						QTextStream qStream(&fileRead);
-						while (!qStream.atEnd())
-						{
-							QString line = qStream.readLine();
-							if (line[0] == '/' && line[1] == '/')
-								continue;
-							displayOrderOverrideList.append(line);
-						}
-						fileRead.close();
-					}
-				}
-
-				for (const auto& componentSettings : species.second.componentMapRef)
-				{
-					speciesMap.at(species.first).genderMap.at(gender.first).poseMap.at(pose.first).componentMap.try_emplace
-					(
-						componentSettings.first, componentData{ }
-					);
-
-					if (!displayOrderOverrideList.isEmpty())
-					{
-						QString componentLine;
-						for (const auto& line : displayOrderOverrideList)
-							if (line.contains(componentSettings.second.assetStr + "="))
-								componentLine = line;
-						if (!componentLine.isEmpty())
-						{
-							speciesMap.at(species.first).genderMap.at(gender.first).poseMap.at(pose.first)
-								.displayOrderZOverrideMap.try_emplace
-								(
-									componentSettings.first,
-									extractSubstringInbetweenQt(componentSettings.second.assetStr + "=", "", componentLine).toInt()
-								);
-						}
-					}
-
-					QStringList assetFolderPathList = fileGetAssetDirectoriesOnStartup(
-						appExecutablePath +
-						"/Assets/Species/" +
-						species.second.assetStr + "/" +
-						gender.second + "/" +
-						pose.second + "/" +
-						componentSettings.second.assetStr
-					);
-
-					// Note: We store as filename only (e.g. NOT including full path), 
-					// so that if exe moves, character saves can still be loaded correctly in relation to loaded assets.
-					for (const auto& assetFolderPath : assetFolderPathList)
-					{
-						speciesMap.at(species.first).genderMap.at(gender.first).poseMap.at(pose.first)
-							.componentMap.at(componentSettings.first).assetsMap.try_emplace
-							(
-								QDir(assetFolderPath).dirName(),
-								assetsData
-								{
-									QDir(assetFolderPath).dirName(),
-									getPathIfExists(assetFolderPath, AssetImgType::FILL),
-									getPathIfExists(assetFolderPath, AssetImgType::OUTLINE),
-									getPathIfExists(assetFolderPath, AssetImgType::THUMBNAIL),
-									componentSettings.second.defaultInitialColor,
-									componentSettings.second.defaultInitialColor,
-									getRelativePos(assetFolderPath + "/pos.zen2dpos")
-								}
-						);
-						//qDebug() << assetFolderPath;
-
-						QString multicolorPath = assetFolderPath + "/multicolor";
-						if (QDir(multicolorPath).exists())
-						{
-							QStringList multicolorPathList = fileGetAssets(multicolorPath);
-							if (multicolorPathList.isEmpty())
-								continue;
-							for (const auto& colorPath : multicolorPathList)
-							{
-								auto& currentAssetsMap = speciesMap.at(species.first).genderMap.at(gender.first).poseMap.at(pose.first)
-									.componentMap.at(componentSettings.first).assetsMap;
-								currentAssetsMap.at(QDir(assetFolderPath).dirName()).subColorsMap.try_emplace
-								(
-									QFileInfo(colorPath).baseName(),
-									subColorData
-									{
-										QFileInfo(colorPath).baseName(),
-										colorPath,
-										componentSettings.second.defaultInitialColor,
-										componentSettings.second.defaultInitialColor,
-									}
-								);
-								currentAssetsMap.at(QDir(assetFolderPath).dirName()).subColorsKeyList.append
-								(QFileInfo(colorPath).baseName());
-							}
-						}
-
-						QString animationPath = assetFolderPath + "/animation";
-						if (QDir(animationPath).exists())
-						{
-							QString animationPropertiesPath = animationPath + "/animationProperties.zen2dani";
-
-							if (!QFile(animationPropertiesPath).exists())
-								continue;
-
-							animationFound = true;
-							animationEnabled = true;
-
-							auto& currentAsset = speciesMap.at(species.first).genderMap.at(gender.first).poseMap.at(pose.first)
-								.componentMap.at(componentSettings.first).assetsMap.at(QDir(assetFolderPath).dirName());
-
-							QStringList animationSequence;
-							int duration;
-							bool animateOutline;
-							bool animateFill;
-							bool repeating;
-							std::pair<int, int> repeatingTimeRange;
-							QEasingCurve::Type easingCurve;
-
-							QFile fileRead(animationPropertiesPath);
-							if (fileRead.open(QIODevice::ReadOnly))
-							{
-								QTextStream qStream(&fileRead);
-								while (!qStream.atEnd())
-								{
-									QString line = qStream.readLine();
-									if (line.contains("animationSequence="))
-									{
-										animationSequence = extractSubstringInbetweenLoopList("[", "]", line);
-									}
-									else if (line.contains("animationDuration="))
-										duration = extractSubstringInbetweenQt("animationDuration=", "", line).toInt();
-									else if (line.contains("animateOutline="))
-										animateOutline = QVariant(extractSubstringInbetweenQt("animateOutline=", "", line)).toBool();
-									else if (line.contains("animateFill="))
-										animateFill = QVariant(extractSubstringInbetweenQt("animateFill=", "", line)).toBool();
-									else if (line.contains("repeating="))
-										repeating = QVariant(extractSubstringInbetweenQt("repeating=", "", line)).toBool();
-									else if (line.contains("repeatingTimeRange="))
-									{
-										QStringList repeatingTimeRangeNumList;
-										repeatingTimeRangeNumList = extractSubstringInbetweenLoopList("[", "]", line);
-										repeatingTimeRange.first = repeatingTimeRangeNumList[0].toInt();
-										repeatingTimeRange.second = repeatingTimeRangeNumList[1].toInt();
-									}
-									else if (line.contains("easingCurve="))
-										easingCurve = qstringToEasingCurveType(extractSubstringInbetweenQt("easingCurve=", "", line));
-								}
-								fileRead.close();
-							}
-
-							currentAsset.animationPropertiesList.emplace_back
-							(
-								animationPropertyData
-								{
-									animationSequence,
-									duration,
-									animateOutline,
-									animateFill,
-									repeating,
-									repeatingTimeRange,
-									easingCurve
-								}
-							);
+	// Asset discovery is the slow part of startup (lots of small filesystem probes), so it runs on a worker pool
+	// and only produces plain data. Merging it into speciesMap, and everything widget-related after that,
+	// stays on this thread.
+	// The manifest from the last launch lets the scanner skip every folder that hasn't changed since then.
+	{
+		AssetManifest assetManifest(assetManifestPath);
+		assetIndexData cachedIndex;
+		assetManifest.read(cachedIndex);
 
-							for (const auto& num : animationSequence)
-							{
-								currentAsset.animationFrameList.emplace_back
-								(
-									animationFrameData
-									{
-									getPathIfExistsAnimation(animationPath + "/" + num, animateOutline, AssetImgType::OUTLINE),
-									getPathIfExistsAnimation(animationPath + "/" + num, animateFill, AssetImgType::FILL)
-									}
-								);
-							}
+		AssetScanner assetScanner(appExecutablePath + "/Assets/Species");
+		assetIndex = assetScanner.scan(cachedIndex);
+		if (assetScanner.rescannedTaskCount() > 0)
+		{
+			if (!assetManifest.write(assetIndex))
+				qDebug() << "Asset manifest could not be written to: " + assetManifestPath;
+		}
+		mergeAssetIndex(assetIndex);
+	}
 
-							currentAsset.animation.get()->setTargetObject
-							(
-								speciesMap.at(species.first).componentUiMap.at(componentSettings.first).item.get()
-							);
-							currentAsset.animation.get()->setPropertyName("pixmap");
-							currentAsset.animation.get()->setDuration(duration);
-							currentAsset.animation.get()->setEasingCurve(easingCurve);
-						}
-					}
-				}
-			}
+	// Default character templates are parsed here, once, and applied from memory from then on.
+	// Each one is re-read only when the watcher sees its file (or its folder, for templates added later) change.
+	connect(templateWatcher.get(), &QFileSystemWatcher::fileChanged, this, [&](const QString &templatePath) {
+		cacheDefaultTemplate(templatePath);
+	});
+	connect(templateWatcher.get(), &QFileSystemWatcher::directoryChanged, this, [&](const QString &templateDir) {
+		cacheDefaultTemplate(templateDir + "/" + defaultTemplateFilename);
+	});
+	for (const auto& species : speciesMap)
+	{
+		for (const auto& gender : species.second.genderMap)
+		{
+			const QString templatePath = defaultTemplatePath(species.second, gender.second);
+			const QString templateDir = QFileInfo(templatePath).path();
+			if (QFileInfo(templateDir).isDir())
+				templateWatcher.get()->addPath(templateDir);
+			cacheDefaultTemplate(templatePath);
 		}
 	}
 
@@ -417,20 +277,12 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 		{
 			if (componentUi.second.settings.partHasBtnSwap)
 			{
-				componentUi.second.btnSwapComponentStyle =
-					componentUi.second.settings.btnStyleSheetTemplate
-					.arg(componentUi.second.settings.btnSwapIcons[0])
-					.arg(componentUi.second.settings.btnSwapIcons[1])
-					.arg(componentUi.second.settings.btnSwapIcons[2])
-					;
-
-				componentUi.second.btnSwapComponentChosenStyle =
-					componentUi.second.settings.btnStyleSheetTemplateChosen
-					.arg(componentUi.second.settings.btnSwapIcons[1])
-					;
-
-				componentUi.second.btnSwapComponent.get()->setStyleSheet(componentUi.second.btnSwapComponentStyle);
-				componentUi.second.btnSwapComponent.get()->setParent(this);
+				componentUi.second.btnSwapComponent.get()->setIcons
+				(
+					componentUi.second.settings.btnSwapIcons[0],
+					componentUi.second.settings.btnSwapIcons[1],
+					componentUi.second.settings.btnSwapIcons[2]
+				);
 				componentUi.second.btnSwapComponent.get()->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 				componentUi.second.btnSwapComponent.get()->setFixedSize
 				(
@@ -440,10 +292,16 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 						componentUi.second.settings.btnSwapHeight
 					)
 				);
-				componentUi.second.btnSwapComponent.get()->setVisible(false);
+				species.second.swapPanelLayout.get()->addWidget
+				(
+					componentUi.second.btnSwapComponent.get(),
+					componentUi.second.settings.gridPlaceSwapComponent[0],
+					componentUi.second.settings.gridPlaceSwapComponent[1],
+					componentUi.second.settings.gridAlignSwapComponent
+				);
 
 				connect(componentUi.second.btnSwapComponent.get(), &QPushButton::clicked, this, [&]() {
-					if (!componentUi.second.btnComponentChosen)
+					if (!componentUi.second.btnSwapComponent.get()->isChosen())
 					{
 						if (soundEnabled)
 						{
@@ -454,41 +312,26 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 						}
 
 						setChosen(false, componentUiCurrentSecond());
-
-						for (auto& asset : componentCurrentSecond().assetsMap)
-						{
-							setChosen(false, asset.second);
-							asset.second.btnSwapAsset.get()->setVisible(false);
-						}
+						componentCurrentSecond().clearChosen();
 
 						setChosen(true, componentUi.second);
 
-						for (auto& asset : poseCurrentSecond().componentMap.at(componentUi.first).assetsMap)
-						{
-							setChosen(false, asset.second);
-							asset.second.btnSwapAsset.get()->setVisible(true);
-						}
-
-						partSwapScroll.get()->verticalScrollBar()->setValue(0);
-						partSwapScroll.get()->horizontalScrollBar()->setValue(0);
-
 						componentCurrent = componentUi.first;
+						componentCurrentSecond().clearChosen();
+						showSwapAssetsForCurrentComponent();
 
-						setChosen(true, assetCurrentSecond());
+						setChosen(true, componentCurrentSecond(), assetCurrentSecond());
 					}
 				});
 			}
 			if (componentUi.second.settings.partHasBtnPickColor)
 			{
-				componentUi.second.btnPickColorStyle =
-					componentUi.second.settings.btnStyleSheetTemplate
-					.arg(componentUi.second.settings.btnPickColorIcons[0])
-					.arg(componentUi.second.settings.btnPickColorIcons[1])
-					.arg(componentUi.second.settings.btnPickColorIcons[2])
-					;
-
-				componentUi.second.btnPickColor.get()->setStyleSheet(componentUi.second.btnPickColorStyle);
-				componentUi.second.btnPickColor.get()->setParent(this);
+				componentUi.second.btnPickColor.get()->setIcons
+				(
+					componentUi.second.settings.btnPickColorIcons[0],
+					componentUi.second.settings.btnPickColorIcons[1],
+					componentUi.second.settings.btnPickColorIcons[2]
+				);
 				componentUi.second.btnPickColor.get()->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 				componentUi.second.btnPickColor.get()->setFixedSize
 				(
@@ -498,7 +341,13 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 						componentUi.second.settings.btnPickColorHeight
 					)
 				);
-				componentUi.second.btnPickColor.get()->setVisible(false);
+				species.second.pickerPanelLayout.get()->addWidget
+				(
+					componentUi.second.btnPickColor.get(),
+					componentUi.second.settings.gridPlacePickColor[0],
+					componentUi.second.settings.gridPlacePickColor[1],
+					componentUi.second.settings.gridAlignPickColor
+				);
 
 				componentUi.second.contextMenuForBtnPickColor.get()->addAction(componentUi.second.actionCopyColor.get());
 				componentUi.second.contextMenuForBtnPickColor.get()->addAction(componentUi.second.actionPasteColor.get());
@@ -513,22 +362,22 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 
 				connect(componentUi.second.actionCopyColor.get(), &QAction::triggered, this, [&]() {
 					auto& componentCurrentSecondLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetKey);
+					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetId);
 					
 					if (assetCurrentSecondLocal.subColorsMap.empty())
-						pickerCopiedColor = assetCurrentSecondLocal.colorAltered;
+						pickerCopiedColor = componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal);
 					else
 					{
 						QStringList dropdownList = assetCurrentSecondLocal.subColorsKeyList;
-						dropdownList.prepend(componentCurrentSecondLocal.displayedAssetKey);
+						dropdownList.prepend(internedNames().str(componentCurrentSecondLocal.displayedAssetId));
 						bool ok;
 						QString pickedKey = getDropdownListItem("Copy Color From", "Part Name:", dropdownList, ok);
 						if (ok && !pickedKey.isEmpty())
 						{
-							if (pickedKey == componentCurrentSecondLocal.displayedAssetKey)
-								pickerCopiedColor = assetCurrentSecondLocal.colorAltered;
+							if (pickedKey == internedNames().str(componentCurrentSecondLocal.displayedAssetId))
+								pickerCopiedColor = componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal);
 							else
-								pickerCopiedColor = assetCurrentSecondLocal.subColorsMap.at(pickedKey).colorAltered;
+								pickerCopiedColor = assetCurrentSecondLocal.subColorsMap.at(internedNames().id(pickedKey)).colorAltered;
 						}
 					}
 					pickerUpdatePasteIconColor(pickerCopiedColor);
@@ -536,111 +385,80 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 
 				connect(componentUi.second.actionPasteColor.get(), &QAction::triggered, this, [&]() {
 					auto& componentCurrentSecondLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetKey);
+					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetId);
 					
 					if (pickerCopiedColor.isValid())
 					{
+						beginSceneUpdate("Paste color");
 						if (assetCurrentSecondLocal.subColorsMap.empty())
 						{
-							assetCurrentSecondLocal.colorAltered = pickerCopiedColor;
+							componentCurrentSecondLocal.setColorAltered(assetCurrentSecondLocal, pickerCopiedColor);
 
 							if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 							{
-								for (auto& asset : componentCurrentSecondLocal.assetsMap)
-								{
-									asset.second.colorAltered = pickerCopiedColor;
-								}
-								for (auto& sub : componentUi.second.settings.sharedColoringSubList)
-								{
-									for (auto& assetSub : poseCurrentSecond().componentMap.at(sub).assetsMap)
-									{
-										assetSub.second.colorAltered = pickerCopiedColor;
-									}
-								}
+								componentCurrentSecondLocal.setColorAlteredAll(pickerCopiedColor);
 							}
 						}
 						else
 						{
 							QStringList dropdownList = assetCurrentSecondLocal.subColorsKeyList;
-							dropdownList.prepend(componentCurrentSecondLocal.displayedAssetKey);
+							dropdownList.prepend(internedNames().str(componentCurrentSecondLocal.displayedAssetId));
 							bool ok;
 							QString pickedKey = getDropdownListItem("Paste Color To", "Part Name:", dropdownList, ok);
 							if (ok && !pickedKey.isEmpty())
 							{
-								if (pickedKey == componentCurrentSecondLocal.displayedAssetKey)
+								if (pickedKey == internedNames().str(componentCurrentSecondLocal.displayedAssetId))
 								{
-									assetCurrentSecondLocal.colorAltered = pickerCopiedColor;
+									componentCurrentSecondLocal.setColorAltered(assetCurrentSecondLocal, pickerCopiedColor);
 									for (auto& subColor : assetCurrentSecondLocal.subColorsMap)
 										subColor.second.colorAltered = pickerCopiedColor;
 									if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 									{
-										for (auto& asset : componentCurrentSecondLocal.assetsMap)
-										{
-											asset.second.colorAltered = pickerCopiedColor;
-										}
+										componentCurrentSecondLocal.setColorAlteredAll(pickerCopiedColor);
 									}
 								}
 								else
-									assetCurrentSecondLocal.subColorsMap.at(pickedKey).colorAltered = pickerCopiedColor;
+									assetCurrentSecondLocal.subColorsMap.at(internedNames().id(pickedKey)).colorAltered = pickerCopiedColor;
 							}
 						}
-						for (auto& sub : componentUi.second.settings.sharedColoringSubList)
-						{
-							auto& subCompCurrentSecondLocal = poseCurrentSecond().componentMap.at(sub);
-							subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-								.colorAltered = pickerCopiedColor;
-							updatePartInScene
-							(
-								speciesCurrentSecond().componentUiMap.at(sub),
-								subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-							);
-
-							for (auto& assetSub : poseCurrentSecond().componentMap.at(sub).assetsMap)
-							{
-								assetSub.second.colorAltered = pickerCopiedColor;
-							}
-						}
-						updatePartInScene(componentUi.second, assetCurrentSecondLocal);
+						propagateSharedColor(componentUi.second, pickerCopiedColor);
+						updatePartInScene(componentUi.second, componentCurrentSecondLocal, assetCurrentSecondLocal);
+						commitSceneUpdate();
 						setCharacterModified(true);
 					}
 				});
 
 				connect(componentUi.second.actionApplyColorToAllInSet.get(), &QAction::triggered, this, [&]() {
 					auto& componentCurrentSecondLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetKey);
+					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetId);
 					
 					if (componentUi.second.settings.colorSetType == ColorSetType::FILL_NO_OUTLINE ||
 						componentUi.second.settings.colorSetType == ColorSetType::FILL_WITH_OUTLINE)
 					{
+						beginSceneUpdate("Apply color to all");
 						QColor currentColor;
 						if (assetCurrentSecondLocal.subColorsMap.empty())
-							currentColor = assetCurrentSecondLocal.colorAltered;
+							currentColor = componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal);
 						else
 						{
 							QStringList dropdownList = assetCurrentSecondLocal.subColorsKeyList;
-							dropdownList.prepend(componentCurrentSecondLocal.displayedAssetKey);
+							dropdownList.prepend(internedNames().str(componentCurrentSecondLocal.displayedAssetId));
 							bool ok;
 							QString pickedKey = getDropdownListItem("Apply Color From", "Part Name:", dropdownList, ok);
 							if (ok && !pickedKey.isEmpty())
 							{
-								if (pickedKey == componentCurrentSecondLocal.displayedAssetKey)
-									currentColor = assetCurrentSecondLocal.colorAltered;
+								if (pickedKey == internedNames().str(componentCurrentSecondLocal.displayedAssetId))
+									currentColor = componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal);
 								else
-									currentColor = assetCurrentSecondLocal.subColorsMap.at(pickedKey).colorAltered;
+									currentColor = assetCurrentSecondLocal.subColorsMap.at(internedNames().id(pickedKey)).colorAltered;
 								for (auto& subColor : assetCurrentSecondLocal.subColorsMap)
 									subColor.second.colorAltered = currentColor;
-								updatePartInScene(componentUi.second, assetCurrentSecondLocal);
-							}
-						}
-						for (auto& sub : componentUi.second.settings.sharedColoringSubList)
-						{
-							for (auto& assetSub : poseCurrentSecond().componentMap.at(sub).assetsMap)
-							{
-								assetSub.second.colorAltered = currentColor;
+								updatePartInScene(componentUi.second, componentCurrentSecondLocal, assetCurrentSecondLocal);
 							}
 						}
-						for (auto& asset : componentCurrentSecondLocal.assetsMap)
-							asset.second.colorAltered = currentColor;
+						propagateSharedColor(componentUi.second, currentColor);
+						componentCurrentSecondLocal.setColorAlteredAll(currentColor);
+						commitSceneUpdate();
 						setCharacterModified(true);
 					}
 				});
@@ -655,50 +473,45 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 					}
 
 					auto& componentCurrentSecondLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetKey);
+					auto& assetCurrentSecondLocal = componentCurrentSecondLocal.assetsMap.at(componentCurrentSecondLocal.displayedAssetId);
 					
+					beginSceneUpdate("Pick color");
 					if (!assetCurrentSecondLocal.subColorsMap.empty())
 					{
 						QStringList dropdownList = assetCurrentSecondLocal.subColorsKeyList;
-						dropdownList.prepend(componentCurrentSecondLocal.displayedAssetKey);
+						dropdownList.prepend(internedNames().str(componentCurrentSecondLocal.displayedAssetId));
 						bool ok;
 						QString pickedKey = getDropdownListItem("Pick Color For", "Part Name:", dropdownList, ok);
 						if (ok && !pickedKey.isEmpty())
 						{
-							if (pickedKey == componentCurrentSecondLocal.displayedAssetKey)
+							if (pickedKey == internedNames().str(componentCurrentSecondLocal.displayedAssetId))
 							{
-								QColor colorNew = QColorDialog::getColor(assetCurrentSecondLocal.colorAltered, this->parentWidget(), "Choose Color");
+								QColor colorNew = QColorDialog::getColor(componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal), this->parentWidget(), "Choose Color");
 								if (colorNew.isValid())
 								{
-									assetCurrentSecondLocal.colorAltered = colorNew;
+									componentCurrentSecondLocal.setColorAltered(assetCurrentSecondLocal, colorNew);
 									for (auto& subColor : assetCurrentSecondLocal.subColorsMap)
 										subColor.second.colorAltered = colorNew;
-									updatePartInScene(componentUi.second, assetCurrentSecondLocal);
+									updatePartInScene(componentUi.second, componentCurrentSecondLocal, assetCurrentSecondLocal);
 									setCharacterModified(true);
 									if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 									{
-										for (auto& asset : componentCurrentSecondLocal.assetsMap)
-										{
-											asset.second.colorAltered = colorNew;
-										}
+										componentCurrentSecondLocal.setColorAlteredAll(colorNew);
 									}
 								}
 							}
 							else
 							{
-								auto& pickedColorObj = assetCurrentSecondLocal.subColorsMap.at(pickedKey);
+								auto& pickedColorObj = assetCurrentSecondLocal.subColorsMap.at(internedNames().id(pickedKey));
 								QColor colorNew = QColorDialog::getColor(pickedColorObj.colorAltered, this->parentWidget(), "Choose Color");
 								if (colorNew.isValid())
 								{
 									pickedColorObj.colorAltered = colorNew;
-									updatePartInScene(componentUi.second, assetCurrentSecondLocal);
+									updatePartInScene(componentUi.second, componentCurrentSecondLocal, assetCurrentSecondLocal);
 									setCharacterModified(true);
 									if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 									{
-										for (auto& asset : componentCurrentSecondLocal.assetsMap)
-										{
-											asset.second.colorAltered = colorNew;
-										}
+										componentCurrentSecondLocal.setColorAlteredAll(colorNew);
 									}
 								}
 							}
@@ -706,37 +519,20 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 					}
 					else
 					{
-						QColor colorNew = QColorDialog::getColor(assetCurrentSecondLocal.colorAltered, this->parentWidget(), "Choose Color");
+						QColor colorNew = QColorDialog::getColor(componentCurrentSecondLocal.colorAltered(assetCurrentSecondLocal), this->parentWidget(), "Choose Color");
 						if (colorNew.isValid())
 						{
-							assetCurrentSecondLocal.colorAltered = colorNew;
-							updatePartInScene(componentUi.second, assetCurrentSecondLocal);
+							componentCurrentSecondLocal.setColorAltered(assetCurrentSecondLocal, colorNew);
+							updatePartInScene(componentUi.second, componentCurrentSecondLocal, assetCurrentSecondLocal);
 							setCharacterModified(true);
-							for (auto& sub : componentUi.second.settings.sharedColoringSubList)
-							{
-								auto& subCompCurrentSecondLocal = poseCurrentSecond().componentMap.at(sub);
-								subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-									.colorAltered = colorNew;
-								updatePartInScene
-								(
-									speciesCurrentSecond().componentUiMap.at(sub),
-									subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-								);
-
-								for (auto& assetSub : poseCurrentSecond().componentMap.at(sub).assetsMap)
-								{
-									assetSub.second.colorAltered = colorNew;
-								}
-							}
+							propagateSharedColor(componentUi.second, colorNew);
 							if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 							{
-								for (auto& asset : componentCurrentSecondLocal.assetsMap)
-								{
-									asset.second.colorAltered = colorNew;
-								}
+								componentCurrentSecondLocal.setColorAlteredAll(colorNew);
 							}
 						}
 					}
+					commitSceneUpdate();
 				});
 			}
 
@@ -745,20 +541,38 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 
 			connect(componentUi.second.animationRepeatingTimer.get(), &QTimer::timeout, this, [&]() {
 				auto& componentCurrentLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-				auto& assetCurrentLocal = componentCurrentLocal.assetsMap.at(componentCurrentLocal.displayedAssetKey);
-				if (assetCurrentLocal.animation.get()->state() == QAbstractAnimation::State::Stopped)
-					assetCurrentLocal.animation.get()->start();
+				auto& assetCurrentLocal = componentCurrentLocal.assetsMap.at(componentCurrentLocal.displayedAssetId);
+				if (assetCurrentLocal.animationData->animation.get()->state() == QAbstractAnimation::State::Stopped)
+					assetCurrentLocal.animationData->animation.get()->start();
 				componentUi.second.animationRepeatingTimer->setInterval
 				(
 					getRandomIntInRange
 					(
-						assetCurrentLocal.animationPropertiesList[0].repeatingTimeRange.first,
-						assetCurrentLocal.animationPropertiesList[0].repeatingTimeRange.second
+						assetCurrentLocal.animationData->properties.repeatingTimeRange.first,
+						assetCurrentLocal.animationData->properties.repeatingTimeRange.second
 					)
 				);
 			});
 		}
 
+		// The species' buttons went into its own panels above; the panels go into the stacks once, here,
+		// and its scene items into one group, so switching species never touches a layout or the scene's item list.
+		species.second.swapPanelLayout.get()->setMargin(0);
+		species.second.swapPanel.get()->setLayout(species.second.swapPanelLayout.get());
+		species.second.swapPanel.get()->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
+		partSwapStack.get()->addWidget(species.second.swapPanel.get());
+
+		species.second.pickerPanelLayout.get()->setMargin(0);
+		species.second.pickerPanel.get()->setLayout(species.second.pickerPanelLayout.get());
+		species.second.pickerPanel.get()->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
+		partPickerStack.get()->addWidget(species.second.pickerPanel.get());
+
+		for (auto& componentUi : species.second.componentUiMap)
+			species.second.sceneLayers.get()->addToGroup(componentUi.second.item.get());
+		species.second.sceneLayers.get()->setZValue(sceneLayersZValue);
+		species.second.sceneLayers.get()->setVisible(false);
+		scene.get()->addItem(species.second.sceneLayers.get());
+
 		for (auto& gender : species.second.genderMap)
 		{
 			gender.second.actionGender.get()->setParent(this);
@@ -805,10 +619,10 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 						// If we can, we go with character as unmodified to ensure no save check, for convenience.
 						// If we can't, we make sure character is set to modified, so there will be a save check.
 						setCharacterModified(false);
-						auto& newPoseSecond = genderCurrentSecond().poseMap.at(pose.first);
+						auto& newPoseSecond = poseMaterialized(speciesCurrent, genderCurrent, pose.first);
 						for (auto& component : poseCurrentSecond().componentMap)
 						{
-							if (newPoseSecond.componentMap.at(component.first).assetsMap.count(component.second.displayedAssetKey) == 0)
+							if (newPoseSecond.componentMap.at(component.first).assetsMap.count(component.second.displayedAssetId) == 0)
 							{
 								setCharacterModified(true);
 								break;
@@ -816,9 +630,10 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 						}
 						if (fileSaveModifCheck())
 						{
+							beginSceneUpdate("Pose switch");
 							setChosen(false, componentUiCurrentSecond());
-							if (!componentCurrentSecond().displayedAssetKey.isEmpty())
-								setChosen(false, assetCurrentSecond());
+							if (componentCurrentSecond().displayedAssetId != StringInterner::invalidId)
+								setChosen(false, componentCurrentSecond(), assetCurrentSecond());
 							removeCurrentSpeciesFromScene();
 							for (auto& component : poseCurrentSecond().componentMap)
 							{
@@ -827,12 +642,12 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 								// We do this so that, where possible, the experience of pose changing is ONLY a 
 								// change of pose. As opposed to user having to redo a bunch of customizations.
 								auto& newPoseComponentSecond = newPoseSecond.componentMap.at(component.first);
-								auto& assetCurrentSecondLocal = component.second.assetsMap.at(component.second.displayedAssetKey);
-								if (newPoseComponentSecond.assetsMap.count(component.second.displayedAssetKey) > 0)
+								auto& assetCurrentSecondLocal = component.second.assetsMap.at(component.second.displayedAssetId);
+								if (newPoseComponentSecond.assetsMap.count(component.second.displayedAssetId) > 0)
 								{
-									newPoseComponentSecond.displayedAssetKey = component.second.displayedAssetKey;
-									auto& newPoseAssetSecond = newPoseComponentSecond.assetsMap.at(newPoseComponentSecond.displayedAssetKey);
-									newPoseAssetSecond.colorAltered = assetCurrentSecondLocal.colorAltered;
+									newPoseComponentSecond.displayedAssetId = component.second.displayedAssetId;
+									auto& newPoseAssetSecond = newPoseComponentSecond.assetsMap.at(newPoseComponentSecond.displayedAssetId);
+									newPoseComponentSecond.setColorAltered(newPoseAssetSecond, component.second.colorAltered(assetCurrentSecondLocal));
 									if (!assetCurrentSecondLocal.subColorsMap.empty() && !newPoseAssetSecond.subColorsMap.empty())
 									{
 										for (auto& subColor : newPoseAssetSecond.subColorsMap)
@@ -840,91 +655,32 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 											if (assetCurrentSecondLocal.subColorsMap.count(subColor.first) > 0)
 											{
 												subColor.second.colorAltered = assetCurrentSecondLocal.subColorsMap.at(subColor.first).colorAltered;
-												updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseAssetSecond);
+												updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseComponentSecond, newPoseAssetSecond);
 											}
 										}
 									}
-									updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseAssetSecond);
+									updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseComponentSecond, newPoseAssetSecond);
 
 									if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
 									{
-										for (auto& asset : newPoseComponentSecond.assetsMap)
-										{
-											asset.second.colorAltered = assetCurrentSecondLocal.colorAltered;;
-										}
+										newPoseComponentSecond.setColorAlteredAll(component.second.colorAltered(assetCurrentSecondLocal));
 									}
 								}
 								else
 								{
-									newPoseComponentSecond.displayedAssetKey = newPoseComponentSecond.assetsMap.begin()->first;
-									auto& newPoseAssetSecond = newPoseComponentSecond.assetsMap.at(newPoseComponentSecond.displayedAssetKey);
-									updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseAssetSecond);
+									newPoseComponentSecond.displayedAssetId = newPoseComponentSecond.assetsMap.begin()->first;
+									auto& newPoseAssetSecond = newPoseComponentSecond.assetsMap.at(newPoseComponentSecond.displayedAssetId);
+									updatePartInScene(speciesCurrentSecond().componentUiMap.at(component.first), newPoseComponentSecond, newPoseAssetSecond);
 								}
 							}
 							poseCurrent = pose.first;
 							applyCurrentSpeciesToScene();
 							setChosen(true, componentUiCurrentSecond());
-							setChosen(true, assetCurrentSecond());
+							setChosen(true, componentCurrentSecond(), assetCurrentSecond());
+							commitSceneUpdate();
 						}
 					}
 				});
-
-				for (auto& component : pose.second.componentMap)
-				{
-					auto& componentUi = species.second.componentUiMap.at(component.first);
-					if (componentUi.settings.partHasBtnSwap)
-					{
-						for (auto& asset : component.second.assetsMap)
-						{
-							asset.second.btnSwapAssetStyle = 
-								componentUi.settings.btnStyleSheetTemplate
-								.arg(asset.second.imgThumbnailPath)
-								.arg(asset.second.imgThumbnailPath)
-								.arg(asset.second.imgThumbnailPath)
-								;
-
-							asset.second.btnSwapAssetChosenStyle =
-								componentUi.settings.btnStyleSheetTemplateChosen
-								.arg(asset.second.imgThumbnailPath)
-								;
-
-							asset.second.btnSwapAsset.get()->setStyleSheet(asset.second.btnSwapAssetStyle);
-							asset.second.btnSwapAsset.get()->setParent(this);
-							asset.second.btnSwapAsset.get()->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-							asset.second.btnSwapAsset.get()->setFixedSize
-							(
-								QSize
-								(
-									componentUi.settings.btnSwapWidth,
-									componentUi.settings.btnSwapHeight
-								)
-							);
-							asset.second.btnSwapAsset.get()->setVisible(false);
-
-							connect(asset.second.btnSwapAsset.get(), &QPushButton::clicked, this, [&]() {
-								if (!asset.second.btnAssetChosen)
-								{
-									if (soundEnabled)
-									{
-										QTimer::singleShot(0, this, [=]() {
-											if (QFile(soundEffectAssetSwap).exists())
-												QSound::play(soundEffectAssetSwap);
-										});
-									}
-
-									setChosen(false, component.second.assetsMap.at(component.second.displayedAssetKey));
-
-									component.second.displayedAssetKey = asset.first;
-
-									setChosen(true, asset.second);
-
-									updatePartInScene(componentUi, asset.second);
-									setCharacterModified(true);
-								}
-							});
-						}
-					}
-				}
 			}
 		}
 	}
@@ -963,15 +719,65 @@ GraphicsDisplay::GraphicsDisplay(QWidget* parent, int width, int height)
 	}
 
 	partSwapGroupLayout.get()->setMargin(20);
+	partSwapGroupLayout.get()->addWidget(partSwapStack.get(), 0, 0);
 	partSwapGroup.get()->setLayout(partSwapGroupLayout.get());
 	partSwapGroup.get()->setFlat(true);
-	layout.get()->addWidget(partSwapScroll.get(), 0, 2, Qt::AlignRight);
 	partSwapScroll.get()->setWidgetResizable(true);
 	partSwapScroll.get()->setWidget(partSwapGroup.get());
 	partSwapScroll.get()->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 	partSwapScroll.get()->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
 
+	// Assets of the current component are listed beside the component buttons, in a view that does its own scrolling
+	// and only paints the rows on screen (see AssetSwapModel).
+	partSwapAssetView.get()->setModel(partSwapAssetModel.get());
+	partSwapAssetView.get()->setItemDelegate(partSwapAssetDelegate.get());
+	partSwapAssetView.get()->setUniformItemSizes(true);
+	partSwapAssetView.get()->setSpacing(partSwapGroupLayout.get()->spacing());
+	partSwapAssetView.get()->setMouseTracking(true);
+	partSwapAssetView.get()->setSelectionMode(QAbstractItemView::NoSelection);
+	partSwapAssetView.get()->setFrameShape(QFrame::NoFrame);
+	partSwapAssetView.get()->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+	partSwapAssetView.get()->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+	partSwapAssetView.get()->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+	connect(thumbnailService.get(), &ThumbnailService::thumbnailReady, this, [&]() {
+		partSwapAssetView.get()->viewport()->update();
+	});
+
+	partSwapPanelLayout.get()->setMargin(0);
+	partSwapPanelLayout.get()->addWidget(partSwapScroll.get());
+	partSwapPanelLayout.get()->addWidget(partSwapAssetView.get());
+	partSwapPanel.get()->setLayout(partSwapPanelLayout.get());
+	layout.get()->addWidget(partSwapPanel.get(), 0, 2, Qt::AlignRight);
+
+	connect(partSwapAssetView.get(), &QListView::clicked, this, [&](const QModelIndex &index) {
+		auto& componentCurrentSecondLocal = componentCurrentSecond();
+		const int assetId = partSwapAssetModel.get()->assetIdAt(index.row());
+		if (componentCurrentSecondLocal.assetsMap.count(assetId) == 0)
+			return;
+		auto& assetPicked = componentCurrentSecondLocal.assetsMap.at(assetId);
+		if (!componentCurrentSecondLocal.chosen(assetPicked))
+		{
+			if (soundEnabled)
+			{
+				QTimer::singleShot(0, this, [=]() {
+					if (QFile(soundEffectAssetSwap).exists())
+						QSound::play(soundEffectAssetSwap);
+				});
+			}
+
+			setChosen(false, componentCurrentSecondLocal, assetCurrentSecond());
+
+			componentCurrentSecondLocal.displayedAssetId = assetId;
+
+			setChosen(true, componentCurrentSecondLocal, assetPicked);
+
+			updatePartInScene(componentUiCurrentSecond(), componentCurrentSecondLocal, assetPicked);
+			setCharacterModified(true);
+		}
+	});
+
 	partPickerGroupLayout.get()->setMargin(20);
+	partPickerGroupLayout.get()->addWidget(partPickerStack.get(), 0, 0);
 	partPickerGroup.get()->setLayout(partPickerGroupLayout.get());
 	partPickerGroup.get()->setFlat(true);
 	layout.get()->addWidget(partPickerScroll.get(), 0, 0, Qt::AlignLeft);
@@ -1081,7 +887,7 @@ void GraphicsDisplay::resizeEvent(QResizeEvent *event)
 	setBackgroundImage(backgroundImage);
 	for (auto& component : poseCurrentSecond().componentMap)
 	{
-		auto& assetInScene = component.second.assetsMap.at(component.second.displayedAssetKey);
+		auto& assetInScene = component.second.assetsMap.at(component.second.displayedAssetId);
 		speciesCurrentSecond().componentUiMap.at(component.first).item.get()->setPos
 		(
 			((this->size().width() - characterFrameSize.width()) / 2) + assetInScene.relativePos.x(),
@@ -1094,199 +900,360 @@ void GraphicsDisplay::resizeEvent(QResizeEvent *event)
 
 // private:
 
-QString GraphicsDisplay::extractSubstringInbetweenQt(const QString strBegin, const QString strEnd, const QString &strExtractFrom)
+// The bound lists are worked out by CharacterRules, so the creator and the compositor share one set of rules.
+void GraphicsDisplay::buildSharedColoringGraph(speciesData &species, const std::map<ComponentType, componentDataSettings> &componentMap)
 {
-	QString extracted = "";
-	int posFound = 0;
-
-	if (!strBegin.isEmpty() && !strEnd.isEmpty())
-	{
-		int posBegin = strExtractFrom.indexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-		int posEnd = strExtractFrom.indexOf(strEnd, posBegin, Qt::CaseSensitive);
-		extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-		posFound = posEnd;
-	}
-	else if (strBegin.isEmpty() && !strEnd.isEmpty())
-	{
-		int posBegin = 0;
-		int posEnd = strExtractFrom.indexOf(strEnd, posBegin, Qt::CaseSensitive);
-		extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-		posFound = posEnd;
-	}
-	else if (!strBegin.isEmpty() && strEnd.isEmpty())
-	{
-		int posBegin = strExtractFrom.indexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-		int posEnd = strExtractFrom.length();
-		extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-		posFound = posEnd;
-	}
-	return extracted;
+	for (auto& componentUi : species.componentUiMap)
+		componentUi.second.sharedColoringBoundList = CharacterRules::sharedColoringBoundList(componentMap, componentUi.first);
 }
 
-QString GraphicsDisplay::extractSubstringInbetweenRevFind(const QString strBegin, const QString strEnd, const QString &strExtractFrom)
+// Carries a color change on to every component bound to this one, shown asset and the rest of the set alike.
+void GraphicsDisplay::propagateSharedColor(const componentUiData &componentUi, const QColor &color)
 {
-	QString extracted = "";
-	int posFound = -1;
-
-	if (!strBegin.isEmpty() && !strEnd.isEmpty())
+	auto& poseCurrentSecondLocal = poseCurrentSecond();
+	for (const auto& boundType : componentUi.sharedColoringBoundList)
 	{
-		while (strExtractFrom.lastIndexOf(strBegin, posFound, Qt::CaseSensitive) != -1)
+		auto& bound = poseCurrentSecondLocal.componentMap.at(boundType);
+		bound.setColorAlteredAll(color);
+		if (bound.displayedAssetId != StringInterner::invalidId)
 		{
-			int posBegin = strExtractFrom.lastIndexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-			int posEnd = strExtractFrom.lastIndexOf(strEnd, posBegin, Qt::CaseSensitive);
-			extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-			posFound--;
+			updatePartInScene
+			(
+				speciesCurrentSecond().componentUiMap.at(boundType),
+				bound,
+				bound.assetsMap.at(bound.displayedAssetId)
+			);
 		}
 	}
-	else if (strBegin.isEmpty() && !strEnd.isEmpty())
+}
+
+void GraphicsDisplay::mergeAssetIndex(const assetIndexData &index)
+{
+	for (const auto& poseIndex : index.poseList)
 	{
-		int posBegin = 0;
-		int posEnd = strExtractFrom.lastIndexOf(strEnd, posBegin, Qt::CaseSensitive);
-		extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-		posFound = posEnd;
+		speciesMap.at(poseIndex.species).genderMap.at(poseIndex.gender).poseMap.at(poseIndex.pose)
+			.displayOrderZOverrideMap = poseIndex.displayOrderZOverrideMap;
 	}
-	else if (!strBegin.isEmpty() && strEnd.isEmpty())
+
+	if (index.animationFound)
 	{
-		int posBegin = strExtractFrom.lastIndexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-		int posEnd = strExtractFrom.length();
-		extracted += strExtractFrom.mid(posBegin, posEnd - posBegin);
-		posFound = posEnd;
+		animationFound = true;
+		animationEnabled = true;
 	}
-	return extracted;
 }
 
-QStringList GraphicsDisplay::extractSubstringInbetweenLoopList(const QString strBegin, const QString strEnd, const QString &strExtractFrom)
+void GraphicsDisplay::mergeComponentIndex(const assetIndexComponentData &componentIndex)
 {
-	QStringList extracted;
-	int posFound = 0;
-
-	if (!strBegin.isEmpty() && !strEnd.isEmpty())
+	auto& componentUi = speciesMap.at(componentIndex.species).componentUiMap.at(componentIndex.component);
+	auto emplacedComponent = speciesMap.at(componentIndex.species).genderMap.at(componentIndex.gender)
+		.poseMap.at(componentIndex.pose).componentMap.try_emplace(componentIndex.component, componentData{ });
+	auto& component = emplacedComponent.first->second;
+	if (emplacedComponent.second)
+		component.colorShared = componentUi.settings.defaultInitialColor;
+
+	// Each component folder is a single scan task, so this is the only time assets are added to the table.
+	// Assets never move once added, so the reserve is only to size the table's name order and chosenList
+	// once, instead of regrowing them as the folder's assets go in.
+	component.assetsMap.reserve(component.assetsMap.size() + componentIndex.assetList.size());
+	component.chosenList.reserve(component.assetsMap.size() + componentIndex.assetList.size());
+	for (const auto& assetIndex : componentIndex.assetList)
 	{
-		while (strExtractFrom.indexOf(strBegin, posFound, Qt::CaseSensitive) != -1)
+
+		auto emplaced = component.assetsMap.try_emplace
+		(
+			internedNames().intern(assetIndex.imgFilename),
+			assetsData
+			{
+				static_cast<int>(component.assetsMap.size()),
+				assetIndex.imgFilename,
+				assetIndex.imgFillPath,
+				assetIndex.imgOutlinePath,
+				assetIndex.imgThumbnailPath,
+				assetIndex.relativePos,
+				CharacterRules::alphaBounds(assetIndex)
+			}
+		);
+		if (!emplaced.second)
+			continue;
+		auto& asset = emplaced.first->second;
+		component.chosenList.emplace_back(false);
+
+		asset.subColorsMap.reserve(assetIndex.subColorList.size());
+		for (const auto& subColorIndex : assetIndex.subColorList)
 		{
-			int posBegin = strExtractFrom.indexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-			int posEnd = strExtractFrom.indexOf(strEnd, posBegin, Qt::CaseSensitive);
-			extracted.append(strExtractFrom.mid(posBegin, posEnd - posBegin));
-			posFound = posEnd;
+			asset.subColorsMap.try_emplace
+			(
+				internedNames().intern(subColorIndex.imgFilename),
+				subColorData
+				{
+					subColorIndex.imgFilename,
+					subColorIndex.imgPath,
+					componentUi.settings.defaultInitialColor,
+					componentUi.settings.defaultInitialColor,
+					subColorIndex.imgBounds
+				}
+			);
+			asset.subColorsKeyList.append(subColorIndex.imgFilename);
+		}
+
+		if (assetIndex.hasAnimation)
+		{
+			const auto& animationIndex = assetIndex.animation;
+			asset.animationData = std::make_unique<assetAnimationData>
+			(
+				assetAnimationData
+				{
+					animationPropertyData
+					{
+						animationIndex.animationSequence,
+						animationIndex.duration,
+						animationIndex.animateOutline,
+						animationIndex.animateFill,
+						animationIndex.repeating,
+						animationIndex.repeatingTimeRange,
+						animationIndex.easingCurve
+					}
+				}
+			);
+			asset.animationData->frameList.reserve(animationIndex.frameList.size());
+			for (const auto& frame : animationIndex.frameList)
+				asset.animationData->frameList.emplace_back(animationFrameData{ frame.imgOutlinePath, frame.imgFillPath });
+
+			asset.animationData->animation.get()->setTargetObject(componentUi.item.get());
+			asset.animationData->animation.get()->setPropertyName("pixmap");
+			asset.animationData->animation.get()->setDuration(animationIndex.duration);
+			asset.animationData->animation.get()->setEasingCurve(animationIndex.easingCurve);
 		}
 	}
-	else if (strBegin.isEmpty() && !strEnd.isEmpty())
-	{
-		int posBegin = 0;
-		int posEnd = strExtractFrom.indexOf(strEnd, posBegin, Qt::CaseSensitive);
-		extracted.append(strExtractFrom.mid(posBegin, posEnd - posBegin));
-		posFound = posEnd;
-	}
-	else if (!strBegin.isEmpty() && strEnd.isEmpty())
-	{
-		int posBegin = strExtractFrom.indexOf(strBegin, posFound, Qt::CaseSensitive) + strBegin.length();
-		int posEnd = strExtractFrom.length();
-		extracted.append(strExtractFrom.mid(posBegin, posEnd - posBegin));
-		posFound = posEnd;
-	}
-	return extracted;
 }
 
-QStringList GraphicsDisplay::fileGetAssetDirectoriesOnStartup(const QString &path)
+poseData& GraphicsDisplay::poseMaterialized(const SpeciesType &species, const GenderType &gender, const PoseType &pose)
 {
-	QStringList assetPathList;
-	QDirIterator dirIt(path, QDir::AllDirs | QDir::NoDotAndDotDot);
-	while (dirIt.hasNext())
-	{
-		QString assetPath = dirIt.next();
-		if (QFileInfo(assetPath).isDir())
-			assetPathList.append(assetPath);
-	}
-	return assetPathList;
+	auto& poseSecond = speciesMap.at(species).genderMap.at(gender).poseMap.at(pose);
+	if (!poseSecond.materialized)
+		materializePose(species, gender, pose);
+	return poseSecond;
 }
 
-QStringList GraphicsDisplay::fileGetAssets(const QString &path)
+// Builds the components and assets for a single pose from the asset index.
+// Only the poses the user actually visits pay for their animations.
+void GraphicsDisplay::materializePose(const SpeciesType &species, const GenderType &gender, const PoseType &pose)
 {
-	QStringList assetPathList;
-	QDirIterator dirIt(path);
-	while (dirIt.hasNext())
+	auto& speciesSecond = speciesMap.at(species);
+	auto& poseSecond = speciesSecond.genderMap.at(gender).poseMap.at(pose);
+	poseSecond.materialized = true;
+
+	for (const auto& componentUi : speciesSecond.componentUiMap)
+		poseSecond.componentMap.try_emplace(componentUi.first, componentData{ });
+
+	for (const auto& componentIndex : assetIndex.componentList)
 	{
-		QString assetPath = dirIt.next();
-		if (QFileInfo(assetPath).suffix() == "png")
-			assetPathList.append(assetPath);
+		if (componentIndex.species == species && componentIndex.gender == gender && componentIndex.pose == pose)
+			mergeComponentIndex(componentIndex);
 	}
-	return assetPathList;
+
+	if (statsLogging)
+		logAssetMemoryReport();
 }
 
-QString GraphicsDisplay::getPathIfExists(const QString &assetFolderPath, const AssetImgType &assetImgType)
+// Logs what the assets of every materialized pose cost in memory, per asset, against what the same assets
+// cost before the hot/cold split (when every asset carried its own button, animation and stylesheet strings).
+// Only the objects themselves are counted, not Qt's private data behind them or the stylesheet text,
+// so the real saving is larger.
+void GraphicsDisplay::logAssetMemoryReport()
 {
-	QString imgPath = assetFolderPath + "/" + QDir(assetFolderPath).dirName();
-	for (const auto& naming : assetImgTypeMap.at(assetImgType))
+	// The asset record as it was laid out before the split, only here so it can be measured.
+	struct unsplitAssetsData
+	{
+		QString imgFilename;
+		QString imgFillPath;
+		QString imgOutlinePath;
+		QString imgThumbnailPath;
+		QColor colorDefault;
+		QColor colorAltered;
+		QPoint relativePos;
+		QRect alphaBounds;
+		std::unique_ptr<QPushButton> btnSwapAsset;
+		QString btnSwapAssetStyle;
+		QString btnSwapAssetChosenStyle;
+		bool btnAssetChosen;
+		InternedTable<subColorData> subColorsMap;
+		QStringList subColorsKeyList;
+		std::vector<animationFrameData> animationFrameList;
+		std::vector<animationPropertyData> animationPropertiesList;
+		std::unique_ptr<QPropertyAnimation> animation;
+	};
+
+	qint64 assetCount = 0;
+	qint64 bytesBefore = 0;
+	qint64 bytesAfter = 0;
+	for (const auto& species : speciesMap)
 	{
-		QString namePath = imgPath + naming + imgExtensionStandard;
-		if (QFile(namePath).exists())
-			return namePath;
+		for (const auto& gender : species.second.genderMap)
+		{
+			for (const auto& pose : gender.second.poseMap)
+			{
+				if (!pose.second.materialized)
+					continue;
+				for (const auto& component : pose.second.componentMap)
+				{
+					bytesAfter += sizeof(QColor) + component.second.colorOverrideMap.size() * (sizeof(int) + sizeof(QColor));
+					bytesAfter += (component.second.chosenList.capacity() + 7) / 8;
+					for (const auto& asset : component.second.assetsMap)
+					{
+						assetCount++;
+						bytesBefore += sizeof(unsplitAssetsData) + sizeof(QPushButton) + sizeof(QPropertyAnimation);
+						bytesAfter += sizeof(assetsData);
+						if (asset.second.animationData)
+						{
+							const qint64 frameBytes = asset.second.animationData->frameList.capacity() * sizeof(animationFrameData);
+							bytesBefore += sizeof(animationPropertyData) + frameBytes;
+							bytesAfter += sizeof(assetAnimationData) + sizeof(QPropertyAnimation) + frameBytes;
+						}
+					}
+				}
+			}
+		}
 	}
-	return imgErrorPath;
+
+	if (assetCount == 0)
+		return;
+	qDebug() << "Asset memory:" << assetCount << "assets,"
+		<< bytesBefore / assetCount << "bytes per asset before the hot/cold split,"
+		<< bytesAfter / assetCount << "after";
 }
 
-QString GraphicsDisplay::getPathIfExistsAnimation(const QString &assetAnimationPath, const bool existenceExpected, const AssetImgType &assetImgType)
+// Handlers that can touch the same part more than once (ex: a pose switch carrying over sub-colors, or a file load
+// recoloring shared-coloring parts as it goes) wrap their work in beginSceneUpdate/commitSceneUpdate.
+// In between, updatePartInScene only marks the part dirty; the commit recomposites each dirty part exactly once,
+// from whatever its state is by then. Transactions nest, so helpers can open their own without caring who called them.
+void GraphicsDisplay::beginSceneUpdate(const QString &actionName)
 {
-	if (existenceExpected)
+	if (sceneUpdate.depth++ == 0)
 	{
-		for (const auto& naming : assetImgTypeMap.at(assetImgType))
-		{
-			QString namePath = assetAnimationPath + naming + imgExtensionStandard;
-			if (QFile(namePath).exists())
-				return namePath;
-		}
-		return imgErrorPath;
+		sceneUpdate.actionName = actionName;
+		sceneUpdate.dirtyList.clear();
+		sceneUpdate.requestCount = 0;
+		sceneUpdate.layersRecoloredCount = 0;
 	}
-	else
-		return QString();
 }
 
-const QPoint GraphicsDisplay::getRelativePos(const QString &posPath)
+void GraphicsDisplay::commitSceneUpdate()
 {
-	int x;
-	int y;
-	QFile fileRead(posPath);
-	if (fileRead.open(QIODevice::ReadOnly))
+	if (--sceneUpdate.depth > 0)
+		return;
+
+	for (const auto& part : sceneUpdate.dirtyList)
+		applyPartToScene(*part.componentUi, *part.component, *part.asset);
+
+	if (statsLogging)
 	{
-		QTextStream qStream(&fileRead);
-		while (!qStream.atEnd())
-		{
-			QString line = qStream.readLine();
-			if (line.contains("x="))
-				x = extractSubstringInbetweenQt("x=", "", line).toInt();
-			else if (line.contains("y="))
-				y = extractSubstringInbetweenQt("y=", "", line).toInt();
-		}
-		fileRead.close();
-		return QPoint(x, y);
+		qDebug() << "Scene update:" << sceneUpdate.actionName
+			<< "- requests:" << sceneUpdate.requestCount
+			<< "parts updated:" << static_cast<int>(sceneUpdate.dirtyList.size())
+			<< "layers recolored:" << sceneUpdate.layersRecoloredCount;
+		qDebug() << "Recolor cache hits:" << recolorCache.hitCount() << "misses:" << recolorCache.missCount()
+			<< "bytes:" << recolorCache.bytesUsed() << "/" << recolorCache.byteBudget();
 	}
-	return QPoint(0, 0);
+	sceneUpdate.dirtyList.clear();
+}
+
+// Outside of a transaction, this is a transaction of its own (ex: a single asset click).
+void GraphicsDisplay::updatePartInScene(const componentUiData &componentUi, const componentData &component, const assetsData &asset)
+{
+	beginSceneUpdate("Part update");
+	sceneUpdate.requestCount++;
+
+	// A part marked again keeps its place in line, but updates to the asset it was marked with last.
+	const auto dirtyIt = std::find_if(sceneUpdate.dirtyList.begin(), sceneUpdate.dirtyList.end(), [&](const sceneUpdatePartData &part) {
+		return part.componentUi == &componentUi;
+	});
+	if (dirtyIt != sceneUpdate.dirtyList.end())
+		*dirtyIt = sceneUpdatePartData{ &componentUi, &component, &asset };
+	else
+		sceneUpdate.dirtyList.emplace_back(sceneUpdatePartData{ &componentUi, &component, &asset });
+
+	commitSceneUpdate();
 }
 
-void GraphicsDisplay::updatePartInScene(const componentUiData &componentUi, const assetsData &asset)
+void GraphicsDisplay::applyPartToScene(const componentUiData &componentUi, const componentData &component, const assetsData &asset)
 {
-	auto setNewPixmapAndPos = [&](const QPixmap &newPix) {
-		componentUi.item.get()->setPixmap(newPix);
-		componentUi.item.get()->setPos
+	// Layers are cropped to the asset's alpha bounds, so the item is offset to put the crop back where it was.
+	auto setNewPixmapAndPos = [this, item = componentUi.item.get(), relativePos = asset.relativePos, offset = asset.alphaBounds.topLeft()](const QPixmap &newPix) {
+		item->setPixmap(newPix);
+		item->setOffset(offset);
+		item->setPos
 		(
-			((this->size().width() - characterFrameSize.width()) / 2) + asset.relativePos.x(),
-			((this->size().height() - characterFrameSize.height()) / 2) + asset.relativePos.y()
+			((this->size().width() - characterFrameSize.width()) / 2) + relativePos.x(),
+			((this->size().height() - characterFrameSize.height()) / 2) + relativePos.y()
 		);
 	};
 
+	// Every request for this part supersedes the ones before it. Jobs still queued for an older generation
+	// skip their painting, and results from them are never applied, so rapid clicking only ever costs
+	// the GUI thread a cache lookup.
+	const quint64 generation = ++*componentUi.recolorGeneration.get();
+	componentUi.recolorWatcher.get()->disconnect(this);
+	componentUi.recolorWatcher.get()->cancel();
+
+	// Paints the jobs across the thread pool and hands each finished layer to applyLayer, in whatever order they finish.
+	auto startRecolorJobs = [&](const std::vector<recolorJobData> &jobList, const std::function<void(const recolorJobData&, const QPixmap&)> &applyLayer) {
+		const std::atomic<quint64> *latestGeneration = componentUi.recolorGeneration.get();
+		const std::function<recolorResultData(const recolorJobData&)> recolorFrame =
+			[this, latestGeneration](const recolorJobData &job) {
+			if (job.generation != latestGeneration->load())
+				return recolorResultData{ QImage(), true };
+			return recolorResultData{ compositor.layer(job), false };
+		};
+		QFutureWatcher<recolorResultData> *watcher = componentUi.recolorWatcher.get();
+		connect(watcher, &QFutureWatcher<recolorResultData>::resultReadyAt, this,
+			[this, watcher, jobList, applyLayer, latestGeneration](int index) {
+			const recolorJobData &job = jobList[index];
+			const recolorResultData result = watcher->resultAt(index);
+			if (result.superseded || job.generation != latestGeneration->load())
+				return;
+			const QPixmap layer = QPixmap::fromImage(result.layer);
+			recolorCache.insert(job.cacheKey, layer);
+			applyLayer(job, layer);
+		});
+		// std::function, since Qt 5's mapped() needs a result_type to deduce the future's type.
+		watcher->setFuture(QtConcurrent::mapped(jobList, recolorFrame));
+	};
+
+	// The first frame is painted right away so the part updates on screen with no delay.
+	// Frames already in recolorCache are installed as-is, and the rest are painted across the thread pool
+	// and dropped into the animation as each one finishes.
 	auto updateAnimationFrames = [&](const PaintType &paintType) {
-		if (asset.animation.get()->state() == QAbstractAnimation::State::Running)
-			asset.animation.get()->pause();
-		qreal increment = 1 / (qreal)(asset.animationFrameList.size() - 1);
+		if (asset.animationData->animation.get()->state() == QAbstractAnimation::State::Running)
+			asset.animationData->animation.get()->pause();
+
+		// A single frame has nothing to step between: it gets the one key value at 0 and the end value.
+		const int lastFrameNum = static_cast<int>(asset.animationData->frameList.size()) - 1;
+		const qreal increment = lastFrameNum > 0 ? 1 / (qreal)lastFrameNum : 1;
 		qreal step = 0;
-		for (int frameNum = 0; frameNum < asset.animationFrameList.size(); frameNum++)
+		std::vector<recolorJobData> jobList;
+		for (int frameNum = 0; frameNum <= lastFrameNum; frameNum++)
 		{
-			QPixmap temp = recolorPixmapSolidWithOutline(asset, frameNum, paintType);
-			asset.animation.get()->setKeyValueAt
-			(
-				step,
-				temp
-			);
+			recolorJobData job = recolorJob(componentUi, component, asset, paintType, frameNum);
+			QPixmap temp;
+			const bool cached = recolorCache.find(job.cacheKey, temp);
+			if (cached || frameNum == 0)
+			{
+				if (!cached)
+				{
+					temp = recolorLayer(componentUi, component, asset, paintType, frameNum);
+					sceneUpdate.layersRecoloredCount++;
+				}
+				asset.animationData->animation.get()->setKeyValueAt(step, temp);
+				if (frameNum == lastFrameNum)
+					asset.animationData->animation.get()->setEndValue(temp);
+			}
+			else
+			{
+				job.generation = generation;
+				job.step = step;
+				jobList.emplace_back(std::move(job));
+			}
 
 			if (step == 0)
 				setNewPixmapAndPos(temp);
@@ -1297,29 +1264,55 @@ void GraphicsDisplay::updatePartInScene(const componentUiData &componentUi, cons
 				step += increment;
 		}
 
-		asset.animation.get()->setEndValue(recolorPixmapSolidWithOutline(asset, asset.animationFrameList.size() - 1, paintType));
+		if (!jobList.empty())
+		{
+			sceneUpdate.layersRecoloredCount += static_cast<int>(jobList.size());
+			QPropertyAnimation *animation = asset.animationData->animation.get();
+			startRecolorJobs(jobList, [animation, lastFrameNum](const recolorJobData &job, const QPixmap &frame) {
+				animation->setKeyValueAt(job.step, frame);
+				if (job.frameNum == lastFrameNum)
+					animation->setEndValue(frame);
+			});
+		}
 
-		if (asset.animation.get()->state() == QAbstractAnimation::State::Paused)
-			asset.animation.get()->resume();
-		else if (asset.animation.get()->state() == QAbstractAnimation::State::Stopped)
-			asset.animation.get()->start();
+		if (asset.animationData->animation.get()->state() == QAbstractAnimation::State::Paused)
+			asset.animationData->animation.get()->resume();
+		else if (asset.animationData->animation.get()->state() == QAbstractAnimation::State::Stopped)
+			asset.animationData->animation.get()->start();
 
-		if (asset.animationPropertiesList[0].repeating)
+		if (asset.animationData->properties.repeating)
 		{
 			componentUi.animationRepeatingTimer->setInterval
 			(
 				getRandomIntInRange
 				(
-					asset.animationPropertiesList[0].repeatingTimeRange.first,
-					asset.animationPropertiesList[0].repeatingTimeRange.second
+					asset.animationData->properties.repeatingTimeRange.first,
+					asset.animationData->properties.repeatingTimeRange.second
 				)
 			);
 
 			componentUi.animationRepeatingTimer.get()->start();
 		}
 
-		//qDebug() << asset.animation.get()->keyValues();
-		//qDebug() << asset.animation.get()->endValue();
+		//qDebug() << asset.animationData->animation.get()->keyValues();
+		//qDebug() << asset.animationData->animation.get()->endValue();
+	};
+
+	// Still layers: shown straight from recolorCache if we have them, otherwise painted off the GUI thread.
+	// The part keeps showing its previous pixmap until the new one is ready.
+	auto updateLayer = [&](const PaintType &paintType) {
+		recolorJobData job = recolorJob(componentUi, component, asset, paintType);
+		QPixmap cached;
+		if (recolorCache.find(job.cacheKey, cached))
+		{
+			setNewPixmapAndPos(cached);
+			return;
+		}
+		job.generation = generation;
+		sceneUpdate.layersRecoloredCount++;
+		startRecolorJobs({ job }, [setNewPixmapAndPos](const recolorJobData &, const QPixmap &layer) {
+			setNewPixmapAndPos(layer);
+		});
 	};
 
 	componentUi.animationRepeatingTimer->stop();
@@ -1328,206 +1321,129 @@ void GraphicsDisplay::updatePartInScene(const componentUiData &componentUi, cons
 	{
 		if (componentUi.settings.colorSetType == ColorSetType::FILL_WITH_OUTLINE)
 		{
-			if (!asset.animationPropertiesList.empty() && animationEnabled)
+			if (asset.animationData && animationEnabled && !asset.animationData->frameList.empty())
 			{
 				updateAnimationFrames(PaintType::SINGLE);
 			}
 			else
 			{
-				QPixmap newPix = recolorPixmapSolidWithOutline(asset, PaintType::SINGLE);
-				setNewPixmapAndPos(newPix);
+				updateLayer(PaintType::SINGLE);
 			}
 		}
 		else if (componentUi.settings.colorSetType == ColorSetType::FILL_NO_OUTLINE)
 		{
-			QPixmap newPix = recolorPixmapSolid(asset, PaintType::SINGLE);
-			setNewPixmapAndPos(newPix);
+			updateLayer(PaintType::SINGLE);
 		}
 		else
 		{
-			QPixmap newPix = asset.imgOutlinePath;
-			setNewPixmapAndPos(newPix);
+			updateLayer(PaintType::SINGLE);
 		}
 	}
 	else
 	{
 		if (componentUi.settings.colorSetType == ColorSetType::FILL_WITH_OUTLINE)
 		{
-			QPixmap newPix = recolorPixmapSolidWithOutline(asset, PaintType::COMBINED);
-			setNewPixmapAndPos(newPix);
+			updateLayer(PaintType::COMBINED);
 		}
 		else if (componentUi.settings.colorSetType == ColorSetType::FILL_NO_OUTLINE)
 		{
-			QPixmap newPix = recolorPixmapSolid(asset, PaintType::COMBINED);
-			setNewPixmapAndPos(newPix);
+			updateLayer(PaintType::COMBINED);
 		}
 		else
 		{
-			QPixmap newPix = asset.imgOutlinePath;
-			setNewPixmapAndPos(newPix);
+			updateLayer(PaintType::SINGLE);
 		}
 	}
 }
 
-QPixmap GraphicsDisplay::recolorPixmapSolid(const QPixmap &img, const QColor &color)
+// Blocks until every part's in-flight recolor has landed in the scene (ex: before rendering it out).
+void GraphicsDisplay::finishPendingRecolors()
 {
-	QPixmap newImage = QPixmap(img);
-	QPainter painter;
-	painter.begin(&newImage);
-	painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-	painter.fillRect(newImage.rect(), color);
-	painter.end();
-	return newImage;
+	for (const auto& componentUi : speciesCurrentSecond().componentUiMap)
+	{
+		componentUi.second.recolorWatcher.get()->waitForFinished();
+		// Results are delivered to the watcher as posted events, so flush those to apply them now.
+		QCoreApplication::sendPostedEvents(componentUi.second.recolorWatcher.get());
+	}
 }
 
-QPixmap GraphicsDisplay::recolorPixmapSolid(const assetsData &asset, const PaintType &paintType)
+// Returns the finished layer for the asset as it's currently colored, only painting it if this exact
+// combination (asset, paint mode, frame, colors) isn't already in recolorCache.
+// frameNum is -1 for the still (non-animated) layer.
+QPixmap GraphicsDisplay::recolorLayer(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum)
 {
-	if (paintType == PaintType::SINGLE)
-	{
-		QPixmap newImage = QPixmap(asset.imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-		painter.fillRect(newImage.rect(), asset.colorAltered);
-		painter.end();
-		return newImage;
-	}
-	else if (paintType == PaintType::COMBINED)
-	{
-		std::vector<QPixmap> recoloredParts;
-		for (const auto& subColor : asset.subColorsMap)
-		{
-			QPixmap recoloredImg = QPixmap(subColor.second.imgPath);
-			QPainter painter;
-			painter.begin(&recoloredImg);
-			painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-			painter.fillRect
-			(
-				QPixmap(subColor.second.imgPath).rect(),
-				subColor.second.colorAltered
-			);
-			painter.end();
-			recoloredParts.emplace_back(recoloredImg);
-		}
-		QPixmap newImage = QPixmap(asset.imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_Source);
-		painter.fillRect(newImage.rect(), Qt::transparent);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		for (const auto& part : recoloredParts)
-		{
-			painter.drawPixmap(part.rect(), part);
-		}
-		painter.end();
-		return newImage;
-	}
-	return imgError;
+	const recolorJobData job = recolorJob(componentUi, component, asset, paintType, frameNum);
+	QPixmap layer;
+	if (recolorCache.find(job.cacheKey, layer))
+		return layer;
+
+	layer = QPixmap::fromImage(compositor.layer(job));
+	recolorCache.insert(job.cacheKey, layer);
+	return layer;
 }
 
-QPixmap GraphicsDisplay::recolorPixmapSolidWithOutline(const assetsData &asset, const PaintType &paintType)
+// Copies out everything painting the layer needs, so the job can run on a worker thread
+// while the asset keeps being edited.
+recolorJobData GraphicsDisplay::recolorJob(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum)
 {
-	if (paintType == PaintType::SINGLE)
+	recolorJobData job;
+	job.frameNum = frameNum;
+	job.cacheKey = recolorCacheKey(componentUi, component, asset, paintType, frameNum);
+	job.paintType = paintType;
+	job.colorSetType = componentUi.settings.colorSetType;
+	job.imgFillPath = asset.imgFillPath;
+	job.imgOutlinePath = asset.imgOutlinePath;
+	job.color = component.colorAltered(asset);
+	job.bounds = asset.alphaBounds;
+	if (frameNum >= 0 && paintType == PaintType::SINGLE)
 	{
-		QPixmap newImage = QPixmap(asset.imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-		painter.fillRect(newImage.rect(), asset.colorAltered);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		painter.drawPixmap(QPixmap(asset.imgOutlinePath).rect(), QPixmap(asset.imgOutlinePath));
-		painter.end();
-		return newImage;
+		if (asset.animationData->properties.animateFill)
+			job.imgFillPath = asset.animationData->frameList[frameNum].imgFillPath;
+		if (asset.animationData->properties.animateOutline)
+			job.imgOutlinePath = asset.animationData->frameList[frameNum].imgOutlinePath;
 	}
 	else if (paintType == PaintType::COMBINED)
 	{
-		std::vector<QPixmap> recoloredParts;
 		for (const auto& subColor : asset.subColorsMap)
-		{
-			QPixmap recoloredImg = QPixmap(subColor.second.imgPath);
-			QPainter painter;
-			painter.begin(&recoloredImg);
-			painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-			painter.fillRect
-			(
-				QPixmap(subColor.second.imgPath).rect(),
-				subColor.second.colorAltered
-			);
-			painter.end();
-			recoloredParts.emplace_back(recoloredImg);
-		}
-		QPixmap newImage = QPixmap(asset.imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_Source);
-		painter.fillRect(newImage.rect(), Qt::transparent);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		for (const auto& part : recoloredParts)
-		{
-			painter.drawPixmap(part.rect(), part);
-		}
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		painter.drawPixmap(QPixmap(asset.imgOutlinePath).rect(), QPixmap(asset.imgOutlinePath));
-		painter.end();
-		return newImage;
+			job.subColorList.emplace_back(recolorJobSubColorData{ subColor.second.imgPath, subColor.second.colorAltered, subColor.second.alphaBounds });
 	}
-	return imgError;
+	return job;
 }
 
-QPixmap GraphicsDisplay::recolorPixmapSolidWithOutline(const assetsData &asset, const int &frameNum, const PaintType &paintType)
+// Only the colors that actually end up in the layer go into the key:
+// the asset color for single fills, each sub-color for combined fills, and none for outline-only parts.
+QByteArray GraphicsDisplay::recolorCacheKey(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum)
 {
-	if (paintType == PaintType::SINGLE)
+	QByteArray key;
+	QDataStream stream(&key, QIODevice::WriteOnly);
+	stream
+		<< asset.imgFillPath
+		<< asset.imgOutlinePath
+		<< qint32(componentUi.settings.colorSetType)
+		<< qint32(paintType)
+		<< qint32(frameNum);
+	if (componentUi.settings.colorSetType != ColorSetType::NONE)
 	{
-		QPixmap newImage;
-		if (!asset.animationPropertiesList[0].animateFill)
-			newImage = QPixmap(asset.imgFillPath);
+		if (paintType == PaintType::SINGLE)
+			stream << component.colorAltered(asset).rgba();
 		else
-			newImage = QPixmap(asset.animationFrameList[frameNum].imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-		painter.fillRect(newImage.rect(), asset.colorAltered);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		if (!asset.animationPropertiesList[0].animateOutline)
-			painter.drawPixmap(QPixmap(asset.imgOutlinePath).rect(), QPixmap(asset.imgOutlinePath));
-		else
-			painter.drawPixmap(QPixmap(asset.animationFrameList[frameNum].imgOutlinePath).rect(), QPixmap(asset.animationFrameList[frameNum].imgOutlinePath));
-		painter.end();
-		return newImage;
-	}
-	else if (paintType == PaintType::COMBINED)
-	{
-		std::vector<QPixmap> recoloredParts;
-		for (const auto& subColor : asset.subColorsMap)
-		{
-			QPixmap recoloredImg = QPixmap(subColor.second.imgPath);
-			QPainter painter;
-			painter.begin(&recoloredImg);
-			painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-			painter.fillRect
-			(
-				QPixmap(subColor.second.imgPath).rect(),
-				subColor.second.colorAltered
-			);
-			painter.end();
-			recoloredParts.emplace_back(recoloredImg);
-		}
-		QPixmap newImage = QPixmap(asset.imgFillPath);
-		QPainter painter;
-		painter.begin(&newImage);
-		painter.setCompositionMode(QPainter::CompositionMode_Source);
-		painter.fillRect(newImage.rect(), Qt::transparent);
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		for (const auto& part : recoloredParts)
 		{
-			painter.drawPixmap(part.rect(), part);
+			for (const auto& subColor : asset.subColorsMap)
+				stream << subColor.second.colorAltered.rgba();
 		}
-		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-		painter.drawPixmap(QPixmap(asset.imgOutlinePath).rect(), QPixmap(asset.imgOutlinePath));
-		painter.end();
-		return newImage;
 	}
-	return imgError;
+	return key;
+}
+
+QPixmap GraphicsDisplay::recolorPixmapSolid(const QPixmap &img, const QColor &color)
+{
+	QPixmap newImage = QPixmap(img);
+	QPainter painter;
+	painter.begin(&newImage);
+	painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+	painter.fillRect(newImage.rect(), color);
+	painter.end();
+	return newImage;
 }
 
 void GraphicsDisplay::pickerUpdatePasteIconColor(const QColor &color)
@@ -1544,208 +1460,184 @@ void GraphicsDisplay::loadDefaultCharacterFromTemplate()
 	// To provide a little more control over default character settings,
 	// a default character can be loaded from a template file.
 	// Template is built identical to a saved character, so the loading logic can be reused.
-	const QString templatePath =
-		appExecutablePath +
-		"/Assets/Species/" +
-		speciesCurrentSecond().assetStr +
-		"/" +
-		genderCurrentSecond().assetStr +
-		"/defaultCharacterTemplate.zen2dx"
-		;
-	if (QFile::exists(templatePath))
+	// Templates are kept parsed in memory (see cacheDefaultTemplate), so switching species/gender reads nothing from disk.
+	const auto templateIt = templateCacheMap.constFind(defaultTemplatePath(speciesCurrentSecond(), genderCurrentSecond()));
+	if (templateIt != templateCacheMap.constEnd())
 	{
-		fileLoadSavedCharacter(templatePath);
+		applyCharacterFile(templateIt.value());
 	}
 }
 
+QString GraphicsDisplay::defaultTemplatePath(const speciesData &species, const genderData &gender) const
+{
+	return appExecutablePath + "/Assets/Species/" + species.assetStr + "/" + gender.assetStr + "/" + defaultTemplateFilename;
+}
+
+// (Re)reads one template into the cache, or drops it if the file is gone.
+// Editors often save by replacing the file, which takes it off the watch list, so it's re-added each time.
+void GraphicsDisplay::cacheDefaultTemplate(const QString &templatePath)
+{
+	templateCacheMap.remove(templatePath);
+	characterFileData character;
+	if (!CharacterFile::read(templatePath, character))
+		return;
+	templateCacheMap.insert(templatePath, character);
+	if (!templateWatcher.get()->files().contains(templatePath))
+		templateWatcher.get()->addPath(templatePath);
+}
+
 void GraphicsDisplay::fileLoadSavedCharacter(const QString &filePath)
 {
+	QElapsedTimer parseTimer;
+	parseTimer.start();
+	characterFileData character;
+	if (!CharacterFile::read(filePath, character))
+		return;
+	if (statsLogging)
+		qDebug() << "Character file parsed in" << parseTimer.nsecsElapsed() / 1000 << "us:" << filePath;
+
+	applyCharacterFile(character);
+}
+
+// Applies a parsed save/template. All the part updates go into one scene update, so each part is recomposited
+// once, after everything (including shared coloring) has been set.
+void GraphicsDisplay::applyCharacterFile(const characterFileData &character)
+{
+	// Whatever's loaded is a different character from the one a library entry was opened as.
+	// (Opening from the library sets the entry again once this is done.)
+	libraryEntryPath.clear();
+	libraryEntryNum = -1;
+
 	setChosen(false, componentUiCurrentSecond());
 
-	if (!componentCurrentSecond().displayedAssetKey.isEmpty())
-		setChosen(false, assetCurrentSecond());
+	if (componentCurrentSecond().displayedAssetId != StringInterner::invalidId)
+		setChosen(false, componentCurrentSecond(), assetCurrentSecond());
 
-	QString fileContents;
-	QFile fileRead(filePath);
-	if (fileRead.open(QIODevice::ReadOnly))
+	beginSceneUpdate("File load");
+	if (character.hasSpeciesGenderPose)
 	{
-		QString missingParts;
-		QTextStream qStream(&fileRead);
-		while (!qStream.atEnd())
+		for (auto& species : speciesMap)
 		{
-			QString line = qStream.readLine();
-			if (line.contains("::Species=") && line.contains("::Gender=") && line.contains("::Pose="))
+			if (species.second.assetStr == character.speciesStr)
 			{
-				QString speciesStr = extractSubstringInbetweenQt("::Species=", "::", line);
-				QString genderStr = extractSubstringInbetweenQt("::Gender=", "::", line);
-				QString poseStr = extractSubstringInbetweenQt("::Pose=", "::", line);
-
-				for (auto& species : speciesMap)
+				for (auto& gender : species.second.genderMap)
 				{
-					if (species.second.assetStr == speciesStr)
+					if (gender.second.assetStr == character.genderStr)
 					{
-						for (auto& gender : species.second.genderMap)
+						for (auto& pose : gender.second.poseMap)
 						{
-							if (gender.second.assetStr == genderStr)
+							if (pose.second.assetStr == character.poseStr)
 							{
-								for (auto& pose : gender.second.poseMap)
-								{
-									if (pose.second.assetStr == poseStr)
-									{
-										removeCurrentSpeciesFromScene();
-										for (auto& gender : speciesCurrentSecond().genderMap)
-											gender.second.actionGender.get()->setVisible(false);
-										for (auto& pose : genderCurrentSecond().poseMap)
-											pose.second.actionPose.get()->setVisible(false);
-										speciesCurrent = species.first;
-										genderCurrent = gender.first;
-										poseCurrent = pose.first;
-										for (auto& gender : speciesCurrentSecond().genderMap)
-											gender.second.actionGender.get()->setVisible(true);
-										for (auto& pose : genderCurrentSecond().poseMap)
-											pose.second.actionPose.get()->setVisible(true);
-										applyCurrentSpeciesToScene();
-										speciesMap.at(speciesCurrent).actionSpecies.get()->setChecked(true);
-										speciesMap.at(speciesCurrent).genderMap.at(genderCurrent)
-											.actionGender->setChecked(true);
-										speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent)
-											.actionPose->setChecked(true);
-										break;
-									}
-								}
+								removeCurrentSpeciesFromScene();
+								for (auto& gender : speciesCurrentSecond().genderMap)
+									gender.second.actionGender.get()->setVisible(false);
+								for (auto& pose : genderCurrentSecond().poseMap)
+									pose.second.actionPose.get()->setVisible(false);
+								speciesCurrent = species.first;
+								genderCurrent = gender.first;
+								poseCurrent = pose.first;
+								for (auto& gender : speciesCurrentSecond().genderMap)
+									gender.second.actionGender.get()->setVisible(true);
+								for (auto& pose : genderCurrentSecond().poseMap)
+									pose.second.actionPose.get()->setVisible(true);
+								applyCurrentSpeciesToScene();
+								speciesMap.at(speciesCurrent).actionSpecies.get()->setChecked(true);
+								speciesMap.at(speciesCurrent).genderMap.at(genderCurrent)
+									.actionGender->setChecked(true);
+								speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent)
+									.actionPose->setChecked(true);
 								break;
 							}
 						}
 						break;
 					}
 				}
+				break;
 			}
-			for (auto& component : speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent).componentMap)
-			{
-				auto& currentComponentUiAt = speciesMap.at(speciesCurrent).componentUiMap.at(component.first);
-				if (line.contains(currentComponentUiAt.settings.assetStr + "="))
-				{
-					if (line.contains(currentComponentUiAt.settings.assetStr + "=[Single]"))
-					{
-						QString assetKey = extractSubstringInbetweenQt("=[Single]", ",", line);
-						if (component.second.assetsMap.count(assetKey) > 0)
-						{
-							component.second.displayedAssetKey = assetKey;
-							component.second.assetsMap.at(assetKey).colorAltered = QColor(extractSubstringInbetweenQt(",", "", line));
-							updatePartInScene(currentComponentUiAt, component.second.assetsMap.at(assetKey));
-							if (component.first == componentCurrent)
-							{
-								setChosen(true, currentComponentUiAt);
-								setChosen(true, component.second.assetsMap.at(assetKey));
-							}
-
-							if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
-							{
-								QColor colorToApply = component.second.assetsMap.at(assetKey).colorAltered;
-								for (auto& asset : component.second.assetsMap)
-								{
-									asset.second.colorAltered = colorToApply;
-								}
-							}
+		}
+	}
 
-							for (auto& sub : currentComponentUiAt.settings.sharedColoringSubList)
-							{
-								auto& subCompCurrentSecondLocal = poseCurrentSecond().componentMap.at(sub);
-								if (!subCompCurrentSecondLocal.displayedAssetKey.isEmpty())
-								{
-									subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-										.colorAltered = component.second.assetsMap.at(assetKey).colorAltered;
-									updatePartInScene
-									(
-										speciesCurrentSecond().componentUiMap.at(sub),
-										subCompCurrentSecondLocal.assetsMap.at(subCompCurrentSecondLocal.displayedAssetKey)
-									);
-								}
+	QString missingParts;
+	for (const auto& componentLoaded : character.componentList)
+	{
+		// Component lines are matched on their interned key, so each line costs one hash lookup.
+		const int lineKeyId = internedNames().id(componentLoaded.assetStr);
+		const auto componentTypeIt = speciesCurrentSecond().componentByAssetStrId.constFind(lineKeyId);
+		if (componentTypeIt == speciesCurrentSecond().componentByAssetStrId.constEnd() ||
+			poseCurrentSecond().componentMap.count(componentTypeIt.value()) == 0)
+			continue;
+		const ComponentType componentType = componentTypeIt.value();
+		auto& currentComponentUiAt = speciesCurrentSecond().componentUiMap.at(componentType);
+		auto& component = poseCurrentSecond().componentMap.at(componentType);
+
+		const int assetKey = internedNames().id(componentLoaded.imgFilename);
+		if (component.assetsMap.count(assetKey) == 0)
+		{
+			missingParts.append(" | " + componentLoaded.imgFilename);
+			continue;
+		}
+		auto& assetLoaded = component.assetsMap.at(assetKey);
+		component.displayedAssetId = assetKey;
+		component.setColorAltered(assetLoaded, componentLoaded.color);
+		if (componentType == componentCurrent)
+		{
+			setChosen(true, currentComponentUiAt);
+			setChosen(true, component, assetLoaded);
+		}
 
-								for (auto& assetSub : poseCurrentSecond().componentMap.at(sub).assetsMap)
-								{
-									assetSub.second.colorAltered = component.second.assetsMap.at(assetKey).colorAltered;
-								}
-							}
-						}
-						else
-							missingParts.append(" | " + assetKey);
-					}
-					else if (line.contains(currentComponentUiAt.settings.assetStr + "=[Combined]"))
-					{
-						QString assetKey = extractSubstringInbetweenQt("=[Combined]", ",", line);
-						if (component.second.assetsMap.count(assetKey) > 0)
-						{
-							component.second.displayedAssetKey = assetKey;
-							component.second.assetsMap.at(assetKey).colorAltered = QColor(extractSubstringInbetweenQt(",", "[Parts]", line));
-							if (component.first == componentCurrent)
-							{
-								setChosen(true, currentComponentUiAt);
-								setChosen(true, component.second.assetsMap.at(assetKey));
-							}
+		if (!componentLoaded.combined)
+		{
+			const QColor colorToApply = component.colorAltered(assetLoaded);
+			if (actionColorChangeSettingsApplyToAllOnPicker.get()->isChecked())
+				component.setColorAlteredAll(colorToApply);
 
-							QString subPartsStr = extractSubstringInbetweenQt("[Parts]=", "", line);
-							QStringList subPartsStrList = extractSubstringInbetweenLoopList("[", "]", subPartsStr);
-							std::map<QString, QString> subPartsStrMap;
-							for (const auto& partsStr : subPartsStrList)
-							{
-								subPartsStrMap.try_emplace
-								(
-									extractSubstringInbetweenQt("[", ",", partsStr),
-									extractSubstringInbetweenQt(",", "]", partsStr)
-								);
-							}
-							for (auto& subColor : component.second.assetsMap.at(assetKey).subColorsMap)
-							{
-								subColor.second.colorAltered = QColor(
-									subPartsStrMap.at(subColor.second.imgFilename)
-								);
-							}
-							updatePartInScene(currentComponentUiAt, component.second.assetsMap.at(assetKey));
-						}
-						else
-							missingParts.append(" | " + assetKey);
-					}
-					break;
-				}
-			}
-			if (line.contains("backgroundColor="))
-			{
-				setBackgroundColor(QColor(extractSubstringInbetweenQt("=", "", line)));
-			}
-			else if (line.contains("backgroundImage="))
-			{
-				setBackgroundImage(extractSubstringInbetweenQt("=", "", line));
-			}
-			for (auto& textInputSL : textInputSingleLineList)
+			propagateSharedColor(currentComponentUiAt, colorToApply);
+		}
+		else
+		{
+			for (auto& subColor : assetLoaded.subColorsMap)
 			{
-				if (line.contains(textInputSL.inputTypeStr + "="))
-				{
-					textInputSL.inputWidget.get()->setText(extractSubstringInbetweenQt("=", "", line));
-				}
+				const auto subColorLoaded = std::find_if(componentLoaded.subColorList.begin(), componentLoaded.subColorList.end(),
+					[&](const characterFileSubColorData &subColorData) { return subColorData.imgFilename == subColor.second.imgFilename; });
+				if (subColorLoaded != componentLoaded.subColorList.end())
+					subColor.second.colorAltered = subColorLoaded->color;
 			}
 		}
-		fileRead.close();
-		setCharacterModified(false);
-		if (!missingParts.isEmpty())
+		updatePartInScene(currentComponentUiAt, component, assetLoaded);
+	}
+
+	if (character.hasBackgroundColor)
+		setBackgroundColor(character.backgroundColor);
+	if (character.hasBackgroundImage)
+		setBackgroundImage(character.backgroundImage);
+	for (const auto& field : character.fieldList)
+	{
+		for (auto& textInputSL : textInputSingleLineList)
 		{
-			QMessageBox::information
-			(
-				this->parentWidget(), 
-				tr("Parts Missing"), 
-				"One or more parts was not found when trying to load from file reference.\r\nSave file only saves references to assets, so if they are moved or deleted, loading may fail.\r\nParts not found are:\r\n" + missingParts
-			);
+			if (field.first == textInputSL.inputTypeStr)
+				textInputSL.inputWidget.get()->setText(field.second);
 		}
 	}
+	commitSceneUpdate();
+
+	setCharacterModified(false);
+	if (!missingParts.isEmpty())
+	{
+		QMessageBox::information
+		(
+			this->parentWidget(), 
+			tr("Parts Missing"), 
+			"One or more parts was not found when trying to load from file reference.\r\nSave file only saves references to assets, so if they are moved or deleted, loading may fail.\r\nParts not found are:\r\n" + missingParts
+		);
+	}
 }
 
 void GraphicsDisplay::fileNew()
 {
-	for (auto& component : speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent).componentMap)
+	for (auto& component : poseCurrentSecond().componentMap)
 	{
-		component.second.displayedAssetKey = component.second.assetsMap.begin()->first;
-		for (auto& asset : component.second.assetsMap)
-			asset.second.colorAltered = asset.second.colorDefault;
+		component.second.displayedAssetId = component.second.assetsMap.begin()->first;
+		component.second.setColorAlteredAll(speciesCurrentSecond().componentUiMap.at(component.first).settings.defaultInitialColor);
 	}
 	backgroundColor = backgroundColorDefault;
 	backgroundImage = backgroundImageDefault;
@@ -1762,7 +1654,7 @@ void GraphicsDisplay::fileNew()
 
 void GraphicsDisplay::fileOpen()
 {
-	QString filename = QFileDialog::getOpenFileName(this, tr("Open"), fileDirLastOpened, tr("Zen Character Creator 2D Files (*.zen2dx)"));
+	QString filename = QFileDialog::getOpenFileName(this, tr("Open"), fileDirLastOpened, tr("Zen Character Creator 2D Files (*.zen2dx *.zen2db)"));
 	if (!filename.isEmpty())
 	{
 		fileLoadSavedCharacter(filename);
@@ -1782,73 +1674,186 @@ bool GraphicsDisplay::fileSave()
 			proposedSaveName += textInputSL.inputWidget.get()->text();
 	}
 	proposedSaveName += QDateTime::currentDateTime().toString("_yyyy_MM_dd_HH_mm_ss");
-	QFileDialog dialog(this, tr("Save As"), proposedSaveName, tr("Zen Character Creator 2D Files (*.zen2dx)"));
+	QFileDialog dialog(this, tr("Save As"), proposedSaveName, tr("Zen Character Creator 2D Files (*.zen2dx);;Zen Character Creator 2D Binary Files (*.zen2db)"));
 	dialog.setWindowModality(Qt::WindowModal);
 	dialog.setAcceptMode(QFileDialog::AcceptSave);
 	if (dialog.exec() == QFileDialog::Accepted)
 	{
 		QString fpath = dialog.selectedFiles().first();
-		QFile fileWrite(fpath);
-		if (fileWrite.open(QIODevice::WriteOnly))
+		if (CharacterFile::write(fpath, characterFileFromScene()))
 		{
-			QTextStream qStream(&fileWrite);
-
-			qStream <<
-				"::"
-				"Species=" + speciesMap.at(speciesCurrent).assetStr +
-				"::" +
-				"Gender=" + speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).assetStr +
-				"::" +
-				"Pose=" + speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent).assetStr +
-				"::"
-				"\r\n";
-
-			for (auto& component : speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent).componentMap)
-			{
-				auto& currentComponentUiAt = speciesMap.at(speciesCurrent).componentUiMap.at(component.first);
-				auto& currentPart = component.second.assetsMap.at(component.second.displayedAssetKey);
-				if (currentPart.subColorsMap.empty())
-				{
-					qStream << currentComponentUiAt.settings.assetStr +
-						"=[Single]" + currentPart.imgFilename +
-						"," + currentPart.colorAltered.name() + "\r\n";
-				}
-				else
-				{
-					qStream << currentComponentUiAt.settings.assetStr +
-						"=[Combined]" + currentPart.imgFilename +
-						"," + currentPart.colorAltered.name();
+			fileDirLastSaved = QFileInfo(fpath).path();
+			return true;
+		}
+	}
+	return false;
+}
 
-					qStream << "[Parts]=";
-					for (const auto& subColor : currentPart.subColorsMap)
-					{
-						qStream <<
-							"[" +
-							subColor.second.imgFilename +
-							"," +
-							subColor.second.colorAltered.name() +
-							"]"
-							;
-					}
+// The current character as it would be saved.
+characterFileData GraphicsDisplay::characterFileFromScene()
+{
+	characterFileData character;
+	character.hasSpeciesGenderPose = true;
+	character.speciesStr = speciesMap.at(speciesCurrent).assetStr;
+	character.genderStr = speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).assetStr;
+	character.poseStr = speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent).assetStr;
 
-					qStream << "\r\n";
-				}
-			}
+	for (auto& component : poseCurrentSecond().componentMap)
+	{
+		auto& currentComponentUiAt = speciesMap.at(speciesCurrent).componentUiMap.at(component.first);
+		auto& currentPart = component.second.assetsMap.at(component.second.displayedAssetId);
+		characterFileComponentData componentSaved;
+		componentSaved.assetStr = currentComponentUiAt.settings.assetStr;
+		componentSaved.combined = !currentPart.subColorsMap.empty();
+		componentSaved.imgFilename = currentPart.imgFilename;
+		componentSaved.color = component.second.colorAltered(currentPart);
+		for (const auto& subColor : currentPart.subColorsMap)
+			componentSaved.subColorList.emplace_back(characterFileSubColorData{ subColor.second.imgFilename, subColor.second.colorAltered });
+		character.componentList.emplace_back(std::move(componentSaved));
+	}
 
-			qStream << "backgroundColor=" + backgroundColor.name() + "\r\n";
-			qStream << "backgroundImage=" + backgroundImage + "\r\n";
+	character.hasBackgroundColor = true;
+	character.backgroundColor = backgroundColor;
+	character.hasBackgroundImage = true;
+	character.backgroundImage = backgroundImage;
 
-			for (const auto& textInputSL : textInputSingleLineList)
-			{
-				qStream << textInputSL.inputTypeStr + "=" + textInputSL.inputWidget.get()->text() + "\r\n";
-			}
+	for (const auto& textInputSL : textInputSingleLineList)
+		character.fieldList.emplace_back(textInputSL.inputTypeStr, textInputSL.inputWidget.get()->text());
 
-			fileWrite.close();
-			fileDirLastSaved = QFileInfo(fpath).path();
-			return true;
+	return character;
+}
+
+// Asks which library to use, and opens it unless it's the one already open.
+bool GraphicsDisplay::libraryOpenFile(const QString &caption, const bool forSaving)
+{
+	const QString filter = tr("Zen Character Creator 2D Libraries (*.zen2dlib)");
+	const QString libraryPath = forSaving
+		? QFileDialog::getSaveFileName(this, caption, fileDirLastLibrary, filter, nullptr, QFileDialog::DontConfirmOverwrite)
+		: QFileDialog::getOpenFileName(this, caption, fileDirLastLibrary, filter);
+	if (libraryPath.isEmpty())
+		return false;
+	fileDirLastLibrary = QFileInfo(libraryPath).path();
+
+	if (characterLibrary.isOpen() && characterLibrary.path() == libraryPath)
+		return true;
+	if (!characterLibrary.open(libraryPath))
+	{
+		QMessageBox::information(this->parentWidget(), tr("Library"), "The library could not be opened:\r\n" + libraryPath);
+		return false;
+	}
+	return true;
+}
+
+// Narrows the library down by name, then opens the picked entry. Only the index is read to list and search,
+// and only the picked character's bytes are decoded.
+void GraphicsDisplay::libraryOpenCharacter()
+{
+	if (!libraryOpenFile(tr("Open Library"), false))
+		return;
+	if (characterLibrary.count() == 0)
+	{
+		QMessageBox::information(this->parentWidget(), tr("Library"), tr("The library has no characters in it yet."));
+		return;
+	}
+
+	bool ok;
+	const QString searchText = QInputDialog::getText(this->parentWidget(), tr("Open Character From Library"), tr("Name contains (leave empty to list all):"), QLineEdit::Normal, QString(), &ok);
+	if (!ok)
+		return;
+	const std::vector<int> matchList = characterLibrary.search(searchText);
+	if (matchList.empty())
+	{
+		QMessageBox::information(this->parentWidget(), tr("Library"), tr("No characters in the library match that name."));
+		return;
+	}
+
+	QStringList itemList;
+	for (const auto& entryNum : matchList)
+	{
+		const auto& entryAt = characterLibrary.entry(entryNum);
+		itemList.append(QString("%1 %2 (#%3)").arg(entryAt.firstName, entryAt.lastName).arg(entryNum + 1).trimmed());
+	}
+	const QString picked = getDropdownListItem(tr("Open Character From Library"), tr("Character:"), itemList, ok);
+	if (!ok || picked.isEmpty())
+		return;
+
+	QElapsedTimer readTimer;
+	readTimer.start();
+	const int entryNum = matchList[itemList.indexOf(picked)];
+	characterFileData character;
+	if (!characterLibrary.read(entryNum, character))
+	{
+		QMessageBox::information(this->parentWidget(), tr("Library"), tr("That character could not be read from the library."));
+		return;
+	}
+	if (statsLogging)
+		qDebug() << "Library entry read in" << readTimer.nsecsElapsed() / 1000 << "us";
+	applyCharacterFile(character);
+	libraryEntryPath = characterLibrary.path();
+	libraryEntryNum = entryNum;
+}
+
+// A character opened from (or already saved to) this library updates its own entry. Anything else is added
+// as a new entry, unless it has the name of one already in there and the user chooses to replace that one.
+// Names alone don't identify a character (generated rosters repeat them, and unnamed characters all match),
+// so a name match is never overwritten without asking.
+bool GraphicsDisplay::librarySaveCharacter()
+{
+	if (!libraryOpenFile(tr("Save To Library"), true))
+		return false;
+
+	const characterFileData character = characterFileFromScene();
+	QString firstName;
+	QString lastName;
+	for (const auto& field : character.fieldList)
+	{
+		if (field.first == CharacterLibrary::firstNameField)
+			firstName = field.second;
+		else if (field.first == CharacterLibrary::lastNameField)
+			lastName = field.second;
+	}
+
+	int entryNum = libraryEntryPath == characterLibrary.path() && libraryEntryNum < characterLibrary.count() ? libraryEntryNum : -1;
+	if (entryNum < 0 && !(firstName.isEmpty() && lastName.isEmpty()))
+	{
+		const int matchNum = characterLibrary.find(firstName, lastName);
+		if (matchNum >= 0)
+		{
+			const QMessageBox::StandardButton ret
+				= QMessageBox::question(this->parentWidget(), tr("Library"),
+					tr("A character named \"%1\" is already in the library.\n"
+						"Do you want to replace it? Choose No to add this one as a new entry.").arg(QString("%1 %2").arg(firstName, lastName).trimmed()),
+					QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel);
+			if (ret == QMessageBox::Cancel)
+				return false;
+			if (ret == QMessageBox::Yes)
+				entryNum = matchNum;
 		}
 	}
-	return false;
+
+	bool saved;
+	if (entryNum >= 0)
+	{
+		saved = characterLibrary.update(entryNum, character);
+	}
+	else
+	{
+		entryNum = characterLibrary.append(character);
+		saved = entryNum >= 0;
+	}
+	if (!saved)
+	{
+		QMessageBox::information(this->parentWidget(), tr("Library"), "The character could not be saved to the library:\r\n" + characterLibrary.path());
+		return false;
+	}
+	libraryEntryPath = characterLibrary.path();
+	libraryEntryNum = entryNum;
+
+	// Updates leave their old records behind, so once those outweigh the live ones the file is rewritten without them.
+	// Doing it only then keeps the cost of compacting spread thin across the saves that made it necessary.
+	if (characterLibrary.deadSize() > QFileInfo(characterLibrary.path()).size() / 2)
+		characterLibrary.compact();
+	return true;
 }
 
 void GraphicsDisplay::fileRenderCharacter()
@@ -1871,6 +1876,7 @@ void GraphicsDisplay::fileRenderCharacter()
 		QString selectedFile = dialog.selectedFiles().first();
 		QFile fileWrite(selectedFile);
 		fileWrite.open(QIODevice::WriteOnly);
+		finishPendingRecolors();
 		QImage composite(scene.get()->sceneRect().size().toSize(), QImage::Format_ARGB32_Premultiplied);
 		composite.fill(backgroundColor);
 		QPainter painter(&composite);
@@ -1896,6 +1902,8 @@ void GraphicsDisplay::setBackgroundImage(const QString &imgPath)
 	backgroundImageItem.get()->setPos(0, 0);
 }
 
+// Takes the current species' panels and layers out of view. Its widgets and items stay where they are
+// (see speciesData::swapPanel), so this and applyCurrentSpeciesToScene cost the same however many parts there are.
 void GraphicsDisplay::removeCurrentSpeciesFromScene()
 {
 	for (auto& componentUi : speciesCurrentSecond().componentUiMap)
@@ -1905,96 +1913,36 @@ void GraphicsDisplay::removeCurrentSpeciesFromScene()
 		if (componentUi.second.settings.partHasBtnSwap)
 		{
 			setChosen(false, componentUi.second);
-			componentUi.second.btnSwapComponent.get()->setVisible(false);
-			partSwapGroupLayout.get()->removeWidget(componentUi.second.btnSwapComponent.get());
-			for (auto& asset : poseCurrentSecond().componentMap.at(componentUi.first).assetsMap)
-			{
-				setChosen(false, asset.second);
-				asset.second.btnSwapAsset.get()->setVisible(false);
-				partSwapGroupLayout.get()->removeWidget(asset.second.btnSwapAsset.get());
-			}
+			poseCurrentSecond().componentMap.at(componentUi.first).clearChosen();
 		}
-		if (componentUi.second.settings.partHasBtnPickColor)
-		{
-			componentUi.second.btnPickColor.get()->setVisible(false);
-			partPickerGroupLayout.get()->removeWidget(componentUi.second.btnPickColor.get());
-		}
-
-		// We remove rather than using QGraphicsScene clear() function,
-		// to avoid deleting the items (they need to be reusable).
-		scene.get()->removeItem(componentUi.second.item.get());
 	}
+	speciesCurrentSecond().swapPanel.get()->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
+	speciesCurrentSecond().pickerPanel.get()->setSizePolicy(QSizePolicy::Ignored, QSizePolicy::Ignored);
+	speciesCurrentSecond().sceneLayers.get()->setVisible(false);
+	partSwapAssetModel.get()->setComponent(nullptr, QSize());
 	componentCurrent = ComponentType::NONE;
 }
 
 void GraphicsDisplay::applyCurrentSpeciesToScene()
 {
-	// Note: We make the widgets visible AFTER adding them to layout.
-	// Otherwise, they may be briefly visible outside of the layout
-	// and then get added to it, causing a flickering effect from the adjustment of position.
-	for (auto& componentUi : speciesCurrentSecond().componentUiMap)
+	// Hidden pages are given Ignored size policies, so the stacks size to the page on show
+	// rather than to the largest species.
+	auto& speciesCurrentSecondLocal = speciesCurrentSecond();
+	speciesCurrentSecondLocal.swapPanel.get()->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
+	speciesCurrentSecondLocal.pickerPanel.get()->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
+	partSwapStack.get()->setCurrentWidget(speciesCurrentSecondLocal.swapPanel.get());
+	partPickerStack.get()->setCurrentWidget(speciesCurrentSecondLocal.pickerPanel.get());
+	speciesCurrentSecondLocal.sceneLayers.get()->setVisible(true);
+
+	for (auto& componentUi : speciesCurrentSecondLocal.componentUiMap)
 	{
-		if (componentUi.second.settings.partHasBtnSwap)
+		if (componentUi.second.settings.partHasBtnSwap && componentUi.first != ComponentType::NONE)
 		{
-			partSwapGroupLayout.get()->addWidget
-			(
-				componentUi.second.btnSwapComponent.get(),
-				componentUi.second.settings.gridPlaceSwapComponent[0],
-				componentUi.second.settings.gridPlaceSwapComponent[1],
-				componentUi.second.settings.gridAlignSwapComponent
-			);
-			int count = componentUi.second.settings.gridPlaceSwapAssetOrigin[0];
-			auto& currentComponentAt = poseCurrentSecond().componentMap.at(componentUi.first);
-			if (currentComponentAt.assetsMap.count("none") > 0)
-				count++;
-			for (auto& asset : currentComponentAt.assetsMap)
-			{
-				if (asset.first == "none")
-				{
-					partSwapGroupLayout.get()->addWidget
-					(
-						asset.second.btnSwapAsset.get(),
-						componentUi.second.settings.gridPlaceSwapAssetOrigin[0],
-						componentUi.second.settings.gridPlaceSwapAssetOrigin[1],
-						componentUi.second.settings.gridAlignSwapAsset
-					);
-				}
-				else
-				{
-					partSwapGroupLayout.get()->addWidget
-					(
-						asset.second.btnSwapAsset.get(),
-						count,
-						componentUi.second.settings.gridPlaceSwapAssetOrigin[1],
-						componentUi.second.settings.gridAlignSwapAsset
-					);
-					count++;
-				}
-			}
-			componentUi.second.btnSwapComponent.get()->setVisible(true);
-
-			if (componentCurrent == ComponentType::NONE && componentUi.first != ComponentType::NONE)
-			{
-				componentCurrent = componentUi.first;
-				for (auto& asset : currentComponentAt.assetsMap)
-				{
-					setChosen(false, asset.second);
-					asset.second.btnSwapAsset.get()->setVisible(true);
-				}
-			}
-		}
-		if (componentUi.second.settings.partHasBtnPickColor)
-		{
-			partPickerGroupLayout.get()->addWidget
-			(
-				componentUi.second.btnPickColor.get(),
-				componentUi.second.settings.gridPlacePickColor[0],
-				componentUi.second.settings.gridPlacePickColor[1],
-				componentUi.second.settings.gridAlignPickColor
-			);
-			componentUi.second.btnPickColor.get()->setVisible(true);
+			componentCurrent = componentUi.first;
+			componentCurrentSecond().clearChosen();
+			showSwapAssetsForCurrentComponent();
+			break;
 		}
-		scene.get()->addItem(componentUi.second.item.get());
 	}
 
 	applyCurrentDisplayOrder();
@@ -2018,32 +1966,32 @@ void GraphicsDisplay::applyCurrentDisplayOrder()
 	}
 }
 
-void GraphicsDisplay::setChosen(bool isChosen, assetsData &asset)
+void GraphicsDisplay::setChosen(bool isChosen, componentData &component, const assetsData &asset)
 {
-	if (isChosen)
-	{
-		asset.btnSwapAsset.get()->setStyleSheet(asset.btnSwapAssetChosenStyle);
-		asset.btnAssetChosen = true;
-	}
-	else
-	{
-		asset.btnSwapAsset.get()->setStyleSheet(asset.btnSwapAssetStyle);
-		asset.btnAssetChosen = false;
-	}
+	component.chosenList[asset.slot] = isChosen;
+	partSwapAssetModel.get()->chosenChanged(component, asset);
+}
+
+// Points the asset column of the swap panel at the current component. Only the rows in view get painted,
+// so this costs the same whether the component has ten assets or ten thousand.
+void GraphicsDisplay::showSwapAssetsForCurrentComponent()
+{
+	const auto& settings = componentUiCurrentSecond().settings;
+	const QSize itemSize = QSize(settings.btnSwapWidth, settings.btnSwapHeight);
+	partSwapAssetModel.get()->setComponent(&componentCurrentSecond(), itemSize);
+	partSwapAssetView.get()->setFixedWidth
+	(
+		itemSize.width() +
+		partSwapAssetView.get()->spacing() * 2 +
+		partSwapAssetView.get()->frameWidth() * 2 +
+		partSwapAssetView.get()->verticalScrollBar()->sizeHint().width()
+	);
+	partSwapAssetView.get()->scrollToTop();
 }
 
 void GraphicsDisplay::setChosen(bool isChosen, componentUiData &componentUi)
 {
-	if (isChosen)
-	{
-		componentUi.btnSwapComponent.get()->setStyleSheet(componentUi.btnSwapComponentChosenStyle);
-		componentUi.btnComponentChosen = true;
-	}
-	else
-	{
-		componentUi.btnSwapComponent.get()->setStyleSheet(componentUi.btnSwapComponentStyle);
-		componentUi.btnComponentChosen = false;
-	}
+	componentUi.btnSwapComponent.get()->setChosen(isChosen);
 }
 
 void GraphicsDisplay::setCharacterModified(const bool newState)
@@ -2085,8 +2033,7 @@ void GraphicsDisplay::toggleAnimation()
 		for (auto& componentUi : speciesCurrentSecond().componentUiMap)
 		{
 			auto& currentComponentLocal = poseCurrentSecond().componentMap.at(componentUi.first);
-			if (!currentComponentLocal.assetsMap.at(currentComponentLocal.displayedAssetKey)
-				.animationPropertiesList.empty())
+			if (currentComponentLocal.assetsMap.at(currentComponentLocal.displayedAssetId).animationData)
 			{
 				componentUi.second.animationRepeatingTimer.get()->start();
 			}
@@ -2112,98 +2059,6 @@ void GraphicsDisplay::toggleSound()
 	}
 }
 
-QEasingCurve::Type GraphicsDisplay::qstringToEasingCurveType(const QString &str)
-{
-	if (str == "Linear")
-		return QEasingCurve::Linear;
-	else if (str == "InQuad")
-		return QEasingCurve::InQuad;
-	else if (str == "OutQuad")
-		return QEasingCurve::OutQuad;
-	else if (str == "InOutQuad")
-		return QEasingCurve::InOutQuad;
-	else if (str == "OutInQuad")
-		return QEasingCurve::OutInQuad;
-	else if (str == "InCubic")
-		return QEasingCurve::InCubic;
-	else if (str == "OutCubic")
-		return QEasingCurve::OutCubic;
-	else if (str == "InOutCubic")
-		return QEasingCurve::InOutCubic;
-	else if (str == "OutInCubic")
-		return QEasingCurve::OutInCubic;
-	else if (str == "InQuart")
-		return QEasingCurve::InQuart;
-	else if (str == "OutQuart")
-		return QEasingCurve::OutQuart;
-	else if (str == "InOutQuart")
-		return QEasingCurve::InOutQuart;
-	else if (str == "OutInQuart")
-		return QEasingCurve::OutInQuart;
-	else if (str == "InQuint")
-		return QEasingCurve::InQuint;
-	else if (str == "OutQuint")
-		return QEasingCurve::OutQuint;
-	else if (str == "InOutQuint")
-		return QEasingCurve::InOutQuint;
-	else if (str == "OutInQuint")
-		return QEasingCurve::OutInQuint;
-	else if (str == "InSine")
-		return QEasingCurve::InSine;
-	else if (str == "OutSine")
-		return QEasingCurve::OutSine;
-	else if (str == "InOutSine")
-		return QEasingCurve::InOutSine;
-	else if (str == "OutInSine")
-		return QEasingCurve::OutInSine;
-	else if (str == "InExpo")
-		return QEasingCurve::InExpo;
-	else if (str == "OutExpo")
-		return QEasingCurve::OutExpo;
-	else if (str == "InOutExpo")
-		return QEasingCurve::InOutExpo;
-	else if (str == "OutInExpo")
-		return QEasingCurve::OutInExpo;
-	else if (str == "InCirc")
-		return QEasingCurve::InCirc;
-	else if (str == "OutCirc")
-		return QEasingCurve::OutCirc;
-	else if (str == "InOutCirc")
-		return QEasingCurve::InOutCirc;
-	else if (str == "OutInCirc")
-		return QEasingCurve::OutInCirc;
-	else if (str == "InElastic")
-		return QEasingCurve::InElastic;
-	else if (str == "OutElastic")
-		return QEasingCurve::OutElastic;
-	else if (str == "InOutElastic")
-		return QEasingCurve::InOutElastic;
-	else if (str == "OutInElastic")
-		return QEasingCurve::OutInElastic;
-	else if (str == "InBack")
-		return QEasingCurve::InBack;
-	else if (str == "OutBack")
-		return QEasingCurve::OutBack;
-	else if (str == "InOutBack")
-		return QEasingCurve::InOutBack;
-	else if (str == "OutInBack")
-		return QEasingCurve::OutInBack;
-	else if (str == "InBounce")
-		return QEasingCurve::InBounce;
-	else if (str == "OutBounce")
-		return QEasingCurve::OutBounce;
-	else if (str == "InOutBounce")
-		return QEasingCurve::InOutBounce;
-	else if (str == "OutInBounce")
-		return QEasingCurve::OutInBounce;
-	else if (str == "BezierSpline")
-		return QEasingCurve::BezierSpline;
-	else if (str == "TCBSpline")
-		return QEasingCurve::TCBSpline;
-	else
-		return QEasingCurve::Linear;
-}
-
 int GraphicsDisplay::getRandomIntInRange(const int &min, const int &max)
 {
 	std::random_device rd;
@@ -2211,39 +2066,3 @@ int GraphicsDisplay::getRandomIntInRange(const int &min, const int &max)
 	std::uniform_int_distribution<int> dist(min, max);
 	return dist(mt);
 }
-
-speciesData& GraphicsDisplay::speciesCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent);
-}
-
-genderData& GraphicsDisplay::genderCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent).genderMap.at(genderCurrent);
-}
-
-poseData& GraphicsDisplay::poseCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent);
-}
-
-componentUiData& GraphicsDisplay::componentUiCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent).componentUiMap.at(componentCurrent);
-}
-
-componentData& GraphicsDisplay::componentCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent)
-		.componentMap.at(componentCurrent);
-}
-
-assetsData& GraphicsDisplay::assetCurrentSecond()
-{
-	return speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent)
-		.componentMap.at(componentCurrent).assetsMap.at
-		(
-			speciesMap.at(speciesCurrent).genderMap.at(genderCurrent).poseMap.at(poseCurrent)
-			.componentMap.at(componentCurrent).displayedAssetKey
-		);
-}
\ No newline at end of file
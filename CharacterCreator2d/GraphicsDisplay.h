@@ -13,7 +13,18 @@ This file is part of Zen Character Creator 2D.
 */
 
 #pragma once
-#include "theme.h"
+#include "SpeciesData.h"
+#include "AssetScanner.h"
+#include "AssetManifest.h"
+#include "ImageCache.h"
+#include "RecolorCache.h"
+#include "RecolorKernel.h"
+#include "AssetSwapModel.h"
+#include "AssetSwapDelegate.h"
+#include "CharacterFile.h"
+#include "CharacterLibrary.h"
+#include "CharacterRules.h"
+#include "CharacterCompositor.h"
 #include <QGraphicsView>
 #include <QGraphicsScene>
 #include <QGridLayout>
@@ -32,12 +43,16 @@ This file is part of Zen Character Creator 2D.
 #include <QInputDialog>
 #include <QLineEdit>
 #include <QDateTime>
+#include <QElapsedTimer>
 #include <QMessageBox>
 #include <QGroupBox>
 #include <QScrollArea>
 #include <QScrollBar>
+#include <QListView>
+#include <QStackedWidget>
 #include <QShortcut>
 #include <QTimer>
+#include <QFileSystemWatcher>
 #include <QSound>
 #include <QMediaPlayer>
 #include <QMediaPlaylist>
@@ -46,9 +61,27 @@ This file is part of Zen Character Creator 2D.
 #include <iterator>
 #include <map>
 #include <random>
+#include <functional>
+#include <atomic>
 
-// Setting for painting recolored image as whole, or as multicolored parts.
-enum class PaintType { SINGLE, COMBINED };
+// A part waiting to be updated in the scene when the current scene update commits.
+struct sceneUpdatePartData
+{
+	const componentUiData *componentUi;
+	const componentData *component;
+	const assetsData *asset;
+};
+
+// Groups the part updates of one user action (ex: a pose switch or a file load), so each part is recomposited
+// once, from its final state, however many times the action asked for it (see beginSceneUpdate).
+struct sceneUpdateData
+{
+	int depth = 0; // Open begin/commit pairs. Only the outermost commit applies anything.
+	QString actionName;
+	std::vector<sceneUpdatePartData> dirtyList; // One entry per part, in the order parts were first marked.
+	int requestCount = 0; // updatePartInScene calls made during the action.
+	int layersRecoloredCount = 0; // Layers (stills or animation frames) that weren't in recolorCache and had to be painted.
+};
 
 struct uiBtnInvisibleSpacer
 {
@@ -82,7 +115,16 @@ private:
 	QString fileDirLastSaved = appExecutablePath + "/Saves";
 	QString fileDirLastRendered = appExecutablePath + "/Renders";
 	QString fileDirLastOpenedImage = appExecutablePath + "/Backgrounds";
+	QString fileDirLastLibrary = appExecutablePath + "/Saves";
+	CharacterLibrary characterLibrary; // Stays open (and mapped) after first use, for browsing the same roster repeatedly.
+	QString libraryEntryPath; // The library the shown character was opened from or last saved to, if any.
+	int libraryEntryNum = -1; // Its entry there; saving to the same library updates just that entry.
+	const QString assetManifestPath = appExecutablePath + "/assetManifest.zen2dcache";
+	const QString defaultTemplateFilename = "defaultCharacterTemplate.zen2dx";
+	QHash<QString, characterFileData> templateCacheMap; // Parsed default character templates, keyed by path.
+	std::unique_ptr<QFileSystemWatcher> templateWatcher = std::make_unique<QFileSystemWatcher>(this);
 	bool characterModified = false;
+	const bool statsLogging = qEnvironmentVariableIsSet("ZEN2D_STATS"); // Set the ZEN2D_STATS environment variable to log memory, cache and timing stats.
 	QString styleSheetEditable = "border: none; background-color: %1;";
 	const QColor backgroundColorDefault = QColor("#FFFFFF");
 	QColor backgroundColor = backgroundColorDefault;
@@ -104,14 +146,23 @@ private:
 	QString backgroundImage = backgroundImageDefault;
 	std::unique_ptr<QGraphicsPixmapItem> backgroundImageItem = std::make_unique<QGraphicsPixmapItem>(nullptr);
 	const int backgroundImageItemZValue = 0;
+	const int sceneLayersZValue = 1; // Each species' layer group sits above the background; parts stack by Z inside it.
 
 	std::unique_ptr<QScrollArea> partSwapScroll = std::make_unique<QScrollArea>(this);
 	std::unique_ptr<QGroupBox> partSwapGroup = std::make_unique<QGroupBox>(this);
 	std::unique_ptr<QGridLayout> partSwapGroupLayout = std::make_unique<QGridLayout>();
+	std::unique_ptr<QStackedWidget> partSwapStack = std::make_unique<QStackedWidget>(this); // One page per species (see speciesData::swapPanel).
+	std::unique_ptr<AssetSwapModel> partSwapAssetModel = std::make_unique<AssetSwapModel>(this);
+	std::unique_ptr<ThumbnailService> thumbnailService = std::make_unique<ThumbnailService>(appExecutablePath + "/ThumbnailCache", this);
+	std::unique_ptr<AssetSwapDelegate> partSwapAssetDelegate = std::make_unique<AssetSwapDelegate>(thumbnailService.get(), this);
+	std::unique_ptr<QListView> partSwapAssetView = std::make_unique<QListView>(this);
+	std::unique_ptr<QWidget> partSwapPanel = std::make_unique<QWidget>(this);
+	std::unique_ptr<QHBoxLayout> partSwapPanelLayout = std::make_unique<QHBoxLayout>();
 
 	std::unique_ptr<QScrollArea> partPickerScroll = std::make_unique<QScrollArea>(this);
 	std::unique_ptr<QGroupBox> partPickerGroup = std::make_unique<QGroupBox>(this);
 	std::unique_ptr<QGridLayout> partPickerGroupLayout = std::make_unique<QGridLayout>();
+	std::unique_ptr<QStackedWidget> partPickerStack = std::make_unique<QStackedWidget>(this);
 
 	std::unique_ptr<QGroupBox> characterNameInputGroup = std::make_unique<QGroupBox>(this);
 	std::unique_ptr<QGridLayout> characterNameInputGroupLayout = std::make_unique<QGridLayout>();
@@ -161,6 +212,8 @@ private:
 	const std::unique_ptr<QAction> actionFileOpen = std::make_unique<QAction>("Open Character");
 	const std::unique_ptr<QAction> actionFileSave = std::make_unique<QAction>("Save Character");
 	const std::unique_ptr<QAction> actionFileRender = std::make_unique<QAction>("Render Character");
+	const std::unique_ptr<QAction> actionLibraryOpen = std::make_unique<QAction>("Open Character From Library");
+	const std::unique_ptr<QAction> actionLibrarySave = std::make_unique<QAction>("Save Character To Library");
 	const std::unique_ptr<QAction> actionSetBackgroundColor = std::make_unique<QAction>("Set Background Color");
 	const std::unique_ptr<QAction> actionSetBackgroundImage = std::make_unique<QAction>("Set Background Image");
 	const std::unique_ptr<QAction> actionClearBackgroundImage = std::make_unique<QAction>("Clear Background Image");
@@ -176,24 +229,13 @@ private:
 	std::unique_ptr<QAction> actionColorChangeSettingsApplyToAllOnPicker = std::make_unique<QAction>("Apply Color Change To All In Set");
 	std::unique_ptr<QAction> actionColorChangeSettingsDontApplyToAllOnPicker = std::make_unique<QAction>("Apply Color Change To Current Item Only");
 
-	std::map<SpeciesType, speciesData> speciesMap;
+	assetIndexData assetIndex; // Kept after startup so poses can be materialized on demand.
+	EnumTable<SpeciesType, speciesData, speciesTypeCount> speciesMap;
 	SpeciesType speciesCurrent = SpeciesType::HUMAN;
 	GenderType genderCurrent = GenderType::FEMALE;
 	PoseType poseCurrent = PoseType::FRONT_FACING;
 	ComponentType componentCurrent = ComponentType::NONE;
 
-	// We can support multiple naming conventions for files here.
-	// Ex: If asset folder is called "tShirt", camel or pascal case will work.
-	// If asset folder is called "t_shirt", snake case will work.
-	const QString imgExtensionStandard = ".png";
-	enum class AssetImgType { FILL, OUTLINE, THUMBNAIL };
-	std::map<AssetImgType, QStringList> assetImgTypeMap =
-	{
-		{AssetImgType::FILL, QStringList{ "Fill", "_fill", "-fill" } },
-		{AssetImgType::OUTLINE, QStringList{ "Outline", "_outline", "-outline" } },
-		{AssetImgType::THUMBNAIL, QStringList{ "Thumbnail", "_thumbnail", "-thumbnail" } },
-	};
-
 	struct textInputSingleLine
 	{
 		const TextInputSingleLineType inputType = TextInputSingleLineType::NONE;
@@ -211,46 +253,75 @@ private:
 	const QPixmap pickerPasteColorIcon = QPixmap(":/ZenCharacterCreator2D/Resources/clipboardColorIcon.png");
 
 	const QPixmap imgError = QPixmap(":/ZenCharacterCreator2D/Resources/error.png");
-	const QString imgErrorPath = ":/ZenCharacterCreator2D/Resources/error.png";
+
+	// Decoded fill/outline/multicolor images. Sized to hold a few poses' worth of assets.
+	const qint64 imageCacheByteBudget = 256 * 1024 * 1024;
+	ImageCache imageCache{ imageCacheByteBudget };
+	CharacterCompositor compositor{ imageCache }; // Paints the scene's layers (see applyPartToScene).
+
+	// Finished layers, so flipping back and forth between a few assets/colors doesn't recomposite each time.
+	const qint64 recolorCacheByteBudget = 128 * 1024 * 1024;
+	RecolorCache recolorCache{ recolorCacheByteBudget };
+
+	sceneUpdateData sceneUpdate;
 
 	// private functions:
-	QString extractSubstringInbetweenQt(const QString strBegin, const QString strEnd, const QString &strExtractFrom);
-	QString extractSubstringInbetweenRevFind(const QString strBegin, const QString strEnd, const QString &strExtractFrom);
-	QStringList extractSubstringInbetweenLoopList(const QString strBegin, const QString strEnd, const QString &strExtractFrom);
-	QStringList fileGetAssetDirectoriesOnStartup(const QString &path);
-	QStringList fileGetAssets(const QString &path);
-	QString getPathIfExists(const QString &assetFolderPath, const AssetImgType &assetImgType);
-	QString getPathIfExistsAnimation(const QString &assetAnimationPath, const bool existenceExpected, const AssetImgType &assetImgType);
-	const QPoint getRelativePos(const QString &posPath);
-	void updatePartInScene(const componentUiData &componentUi, const assetsData &asset);
+	void buildSharedColoringGraph(speciesData &species, const std::map<ComponentType, componentDataSettings> &componentMap);
+	void propagateSharedColor(const componentUiData &componentUi, const QColor &color);
+	void mergeAssetIndex(const assetIndexData &index);
+	void mergeComponentIndex(const assetIndexComponentData &componentIndex);
+	poseData& poseMaterialized(const SpeciesType &species, const GenderType &gender, const PoseType &pose);
+	void materializePose(const SpeciesType &species, const GenderType &gender, const PoseType &pose);
+	void logAssetMemoryReport();
+	void beginSceneUpdate(const QString &actionName);
+	void commitSceneUpdate();
+	void updatePartInScene(const componentUiData &componentUi, const componentData &component, const assetsData &asset);
+	void applyPartToScene(const componentUiData &componentUi, const componentData &component, const assetsData &asset);
+	void finishPendingRecolors();
+	QPixmap recolorLayer(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum = -1);
+	recolorJobData recolorJob(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum = -1);
+	QByteArray recolorCacheKey(const componentUiData &componentUi, const componentData &component, const assetsData &asset, const PaintType &paintType, const int &frameNum);
 	QPixmap recolorPixmapSolid(const QPixmap &img, const QColor &color);
-	QPixmap recolorPixmapSolid(const assetsData &asset, const PaintType &paintType);
-	QPixmap recolorPixmapSolidWithOutline(const assetsData &asset, const PaintType &paintType);
-	QPixmap recolorPixmapSolidWithOutline(const assetsData &asset, const int &frameNum, const PaintType &paintType);
 	void pickerUpdatePasteIconColor(const QColor &color);
 	void loadDefaultCharacterFromTemplate();
+	QString defaultTemplatePath(const speciesData &species, const genderData &gender) const;
+	void cacheDefaultTemplate(const QString &templatePath);
 	void fileLoadSavedCharacter(const QString &filePath);
+	void applyCharacterFile(const characterFileData &character);
 	void fileNew();
 	void fileOpen();
 	bool fileSave();
+	characterFileData characterFileFromScene();
+	bool libraryOpenFile(const QString &caption, const bool forSaving);
+	void libraryOpenCharacter();
+	bool librarySaveCharacter();
 	void fileRenderCharacter();
 	void setBackgroundColor(const QColor &color);
 	void setBackgroundImage(const QString &imgPath);
 	void removeCurrentSpeciesFromScene();
 	void applyCurrentSpeciesToScene();
 	void applyCurrentDisplayOrder();
-	void setChosen(bool isChosen, assetsData &asset);
+	void setChosen(bool isChosen, componentData &component, const assetsData &asset);
 	void setChosen(bool isChosen, componentUiData &componentUi);
+	void showSwapAssetsForCurrentComponent();
 	void setCharacterModified(const bool newState);
 	const QString getDropdownListItem(const QString &title, const QString &label, const QStringList &items, bool &ok);
 	void toggleAnimation();
 	void toggleSound();
-	QEasingCurve::Type qstringToEasingCurveType(const QString &str);
 	int getRandomIntInRange(const int &min, const int &max);
-	speciesData& speciesCurrentSecond();
-	genderData& genderCurrentSecond();
-	poseData& poseCurrentSecond();
-	componentUiData& componentUiCurrentSecond();
-	componentData& componentCurrentSecond();
-	assetsData& assetCurrentSecond();
+
+	// Views onto the current selection. Species/gender/pose/component are plain array indexes into the tables,
+	// so these are cheap enough to call freely from handlers.
+	// Everything that works with the current pose goes through poseCurrentSecond, so the pose is materialized
+	// on first access (ex: applyCurrentSpeciesToScene after a species/gender/pose change, or loading a saved character).
+	speciesData& speciesCurrentSecond() { return speciesMap.at(speciesCurrent); }
+	genderData& genderCurrentSecond() { return speciesMap.at(speciesCurrent).genderMap.at(genderCurrent); }
+	poseData& poseCurrentSecond() { return poseMaterialized(speciesCurrent, genderCurrent, poseCurrent); }
+	componentUiData& componentUiCurrentSecond() { return speciesMap.at(speciesCurrent).componentUiMap.at(componentCurrent); }
+	componentData& componentCurrentSecond() { return poseCurrentSecond().componentMap.at(componentCurrent); }
+	assetsData& assetCurrentSecond()
+	{
+		auto& componentCurrentLocal = componentCurrentSecond();
+		return componentCurrentLocal.assetsMap.at(componentCurrentLocal.displayedAssetId);
+	}
 };
\ No newline at end of file
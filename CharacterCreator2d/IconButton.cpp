@@ -0,0 +1,73 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "IconButton.h"
+#include "theme.h"
+
+IconButton::IconButton(QWidget *parent)
+	: QPushButton(parent)
+{
+	setAttribute(Qt::WA_Hover);
+}
+
+void IconButton::setIcons(const QString &normalPath, const QString &hoverPath, const QString &pressedPath)
+{
+	// QPixmap::load goes through the global pixmap cache, so buttons sharing an icon (ex: the pencil sketch
+	// on most swap buttons) share one decoded copy.
+	normalIcon.load(normalPath);
+	hoverIcon.load(hoverPath);
+	pressedIcon.load(pressedPath);
+	update();
+}
+
+void IconButton::setChosen(const bool isChosen)
+{
+	if (chosen == isChosen)
+		return;
+	chosen = isChosen;
+	update();
+}
+
+// Same looks the stylesheet templates gave: a chosen button keeps the hover icon over the chosen background,
+// otherwise hover shows the hover icon (or the pressed one while held down) over the hover background.
+void IconButton::paintEvent(QPaintEvent *event)
+{
+	QPainter painter(this);
+	const QPixmap *icon = &normalIcon;
+	if (chosen)
+	{
+		painter.fillRect(rect(), btnChosenBackground);
+		icon = &hoverIcon;
+	}
+	else if (underMouse())
+	{
+		painter.fillRect(rect(), btnHoverBackground);
+		icon = isDown() ? &pressedIcon : &hoverIcon;
+	}
+	else
+		painter.fillRect(rect(), btnBackground);
+
+	if (icon->isNull())
+		return;
+
+	// Like the stylesheet image property: scaled down to fit (never up), keeping aspect ratio, centered.
+	QSize iconSize = icon->size() / icon->devicePixelRatioF();
+	if (iconSize.width() > width() || iconSize.height() > height())
+		iconSize.scale(size(), Qt::KeepAspectRatio);
+	QRect iconRect = QRect(QPoint(0, 0), iconSize);
+	iconRect.moveCenter(rect().center());
+	painter.setRenderHint(QPainter::SmoothPixmapTransform);
+	painter.drawPixmap(iconRect, *icon);
+}
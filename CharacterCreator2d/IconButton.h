@@ -0,0 +1,43 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include <QPushButton>
+#include <QPixmap>
+#include <QPainter>
+#include <QString>
+
+// Swap/picker button that paints its own normal, hover, pressed and chosen looks from icons decoded once up front,
+// instead of being styled with a per-button stylesheet. Changing state never re-parses CSS or repolishes the widget:
+// hover/press repaint through WA_Hover and the usual button events, and setChosen is a flag flip plus update().
+class IconButton : public QPushButton
+{
+	Q_OBJECT
+
+public:
+	IconButton(QWidget *parent = nullptr);
+	void setIcons(const QString &normalPath, const QString &hoverPath, const QString &pressedPath);
+	void setChosen(const bool isChosen);
+	bool isChosen() const { return chosen; }
+
+protected:
+	void paintEvent(QPaintEvent *event) override;
+
+private:
+	QPixmap normalIcon;
+	QPixmap hoverIcon;
+	QPixmap pressedIcon;
+	bool chosen = false;
+};
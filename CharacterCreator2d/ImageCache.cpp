@@ -0,0 +1,66 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ImageCache.h"
+
+ImageCache::ImageCache(const qint64 &byteBudget)
+{
+	imageMap.setMaxCost(static_cast<int>(byteBudget / 1024 / 5 * 4));
+	maskMap.setMaxCost(static_cast<int>(byteBudget / 1024 / 5));
+}
+
+QImage ImageCache::image(const QString &path)
+{
+	return lookup(imageMap, path, QImage::Format_ARGB32_Premultiplied);
+}
+
+QImage ImageCache::alphaMask(const QString &path)
+{
+	return lookup(maskMap, path, QImage::Format_Alpha8);
+}
+
+// Returns a shallow copy; callers that paint on it detach their own copy and leave the cached one untouched.
+// A path that can't be loaded gives a null image, same as constructing a QPixmap from it would.
+QImage ImageCache::lookup(QCache<QString, QImage> &cache, const QString &path, const QImage::Format &format)
+{
+	{
+		QMutexLocker locker(&imageMapMutex);
+		if (QImage *cached = cache.object(path))
+			return *cached;
+	}
+
+	// Decoding happens outside the lock, so other threads aren't held up by a slow PNG.
+	// If two threads miss on the same path at once, both decode and the second insert just replaces the first.
+	QImage decoded = QImage(path).convertToFormat(format);
+	if (decoded.isNull())
+		return decoded;
+
+	QMutexLocker locker(&imageMapMutex);
+	const int cost = std::max(1, static_cast<int>(decoded.sizeInBytes() / 1024));
+	cache.insert(path, new QImage(decoded), cost);
+	return decoded;
+}
+
+void ImageCache::clear()
+{
+	QMutexLocker locker(&imageMapMutex);
+	imageMap.clear();
+	maskMap.clear();
+}
+
+qint64 ImageCache::bytesUsed() const
+{
+	QMutexLocker locker(&imageMapMutex);
+	return static_cast<qint64>(imageMap.totalCost() + maskMap.totalCost()) * 1024;
+}
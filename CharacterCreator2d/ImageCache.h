@@ -0,0 +1,45 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <QImage>
+#include <QCache>
+#include <QMutex>
+#include <QString>
+#include <algorithm>
+
+// Decoded images shared by every recolor path, keyed by file path.
+// Images are stored premultiplied (the format QPainter composes in), and fill/multicolor layers can also be
+// fetched as 8-bit alpha masks (all the recolor kernel reads from them), so a recolor never has to
+// decode or convert anything once an asset has been seen. The cache is bounded by decoded size;
+// least recently used images are dropped first once the budget is reached.
+// Safe to use from worker threads.
+class ImageCache
+{
+public:
+	ImageCache(const qint64 &byteBudget);
+	QImage image(const QString &path);
+	QImage alphaMask(const QString &path);
+	void clear();
+	qint64 bytesUsed() const;
+
+private:
+	// QCache costs are ints, so we count in kilobytes to keep large budgets in range.
+	// Masks are a quarter the size of full images, so they get a quarter of the budget.
+	QCache<QString, QImage> imageMap;
+	QCache<QString, QImage> maskMap;
+	mutable QMutex imageMapMutex;
+
+	QImage lookup(QCache<QString, QImage> &cache, const QString &path, const QImage::Format &format);
+};
@@ -0,0 +1,70 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "RecolorCache.h"
+
+RecolorCache::RecolorCache(const qint64 &byteBudget)
+{
+	setByteBudget(byteBudget);
+}
+
+bool RecolorCache::find(const QByteArray &key, QPixmap &pixmap)
+{
+	if (QPixmap *cached = pixmapMap.object(key))
+	{
+		pixmap = *cached;
+		hits++;
+		return true;
+	}
+	misses++;
+	return false;
+}
+
+void RecolorCache::insert(const QByteArray &key, const QPixmap &pixmap)
+{
+	if (pixmap.isNull())
+		return;
+	const qint64 bytes = static_cast<qint64>(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+	pixmapMap.insert(key, new QPixmap(pixmap), std::max(1, static_cast<int>(bytes / 1024)));
+}
+
+void RecolorCache::clear()
+{
+	pixmapMap.clear();
+}
+
+void RecolorCache::setByteBudget(const qint64 &byteBudget)
+{
+	pixmapMap.setMaxCost(static_cast<int>(byteBudget / 1024));
+}
+
+qint64 RecolorCache::byteBudget() const
+{
+	return static_cast<qint64>(pixmapMap.maxCost()) * 1024;
+}
+
+qint64 RecolorCache::bytesUsed() const
+{
+	return static_cast<qint64>(pixmapMap.totalCost()) * 1024;
+}
+
+quint64 RecolorCache::hitCount() const
+{
+	return hits;
+}
+
+quint64 RecolorCache::missCount() const
+{
+	return misses;
+}
@@ -0,0 +1,44 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <QPixmap>
+#include <QCache>
+#include <QByteArray>
+#include <algorithm>
+
+// Finished recolored layers (fill + colors + outline, per animation frame), so going back to an
+// asset/color combination that was just shown is a lookup instead of a recomposite.
+// Keys are built by the caller from everything that affects the result (asset paths, paint mode, frame, colors).
+// Least recently used layers are dropped first once the byte budget is reached.
+// Holds QPixmaps, so it's only used from the GUI thread.
+class RecolorCache
+{
+public:
+	RecolorCache(const qint64 &byteBudget);
+	bool find(const QByteArray &key, QPixmap &pixmap);
+	void insert(const QByteArray &key, const QPixmap &pixmap);
+	void clear();
+	void setByteBudget(const qint64 &byteBudget);
+	qint64 byteBudget() const;
+	qint64 bytesUsed() const;
+	quint64 hitCount() const;
+	quint64 missCount() const;
+
+private:
+	// QCache costs are ints, so we count in kilobytes to keep large budgets in range.
+	QCache<QByteArray, QPixmap> pixmapMap;
+	quint64 hits = 0;
+	quint64 misses = 0;
+};
@@ -0,0 +1,649 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "RecolorKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RECOLOR_KERNEL_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#define RECOLOR_KERNEL_NEON
+#include <arm_neon.h>
+#endif
+
+// MSVC allows any intrinsic in any function. GCC/Clang need the target enabled per function,
+// so the rest of the file can still be built for baseline x86.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RECOLOR_KERNEL_TARGET_SSE4_1
+#define RECOLOR_KERNEL_TARGET_AVX2
+#else
+#define RECOLOR_KERNEL_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define RECOLOR_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+// Every path below is built from two steps, per pixel and per channel:
+//     tint = BYTE_MUL(color, mask)                          (SourceIn fill)
+//     dest = src + BYTE_MUL(dest, 255 - alpha(src))         (SourceOver, src being a tint or the outline)
+// where BYTE_MUL(x, a) = (x * a + ((x * a) >> 8) + 0x80) >> 8, the same rounding Qt uses.
+// SourceOver's special cases (opaque or fully transparent source pixels) fall out of the general formula,
+// so there's no per-pixel branching.
+
+static inline quint32 byteMulScalar(const quint32 x, const quint32 a)
+{
+	quint32 t = (x & 0xff00ff) * a;
+	t = (t + ((t >> 8) & 0xff00ff) + 0x800080) >> 8;
+	t &= 0xff00ff;
+	quint32 u = ((x >> 8) & 0xff00ff) * a;
+	u = (u + ((u >> 8) & 0xff00ff) + 0x800080);
+	u &= 0xff00ff00;
+	return u | t;
+}
+
+static void tintRowScalar(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	for (int i = 0; i < length; i++)
+		dest[i] = byteMulScalar(color, mask[i]);
+}
+
+static void tintOverRowScalar(quint32 *dest, const uchar *mask, const quint32 color, const quint32 *outline, const int length)
+{
+	for (int i = 0; i < length; i++)
+	{
+		const quint32 o = outline[i];
+		dest[i] = o + byteMulScalar(byteMulScalar(color, mask[i]), 255 - (o >> 24));
+	}
+}
+
+static void tintAccumulateRowScalar(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	for (int i = 0; i < length; i++)
+	{
+		const quint32 t = byteMulScalar(color, mask[i]);
+		dest[i] = t + byteMulScalar(dest[i], 255 - (t >> 24));
+	}
+}
+
+static void overRowScalar(quint32 *dest, const quint32 *outline, const int length)
+{
+	for (int i = 0; i < length; i++)
+	{
+		const quint32 o = outline[i];
+		dest[i] = o + byteMulScalar(dest[i], 255 - (o >> 24));
+	}
+}
+
+#if defined(RECOLOR_KERNEL_X86)
+
+// 16-bit lanes: (t + (t >> 8) + 0x80) >> 8. Products are at most 255 * 255, so nothing overflows.
+RECOLOR_KERNEL_TARGET_SSE4_1
+static inline __m128i byteMulSse(const __m128i x16, const __m128i a16)
+{
+	const __m128i t = _mm_mullo_epi16(x16, a16);
+	return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), _mm_set1_epi16(0x80)), 8);
+}
+
+// Four pixels per step, each half of the register holding two pixels as 16-bit channels.
+RECOLOR_KERNEL_TARGET_SSE4_1
+static void tintOverRowSse41(quint32 *dest, const uchar *mask, const quint32 color, const quint32 *outline, const int length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+	const __m128i maskShuffleLo = _mm_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+	const __m128i maskShuffleHi = _mm_setr_epi8(2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1);
+	const __m128i alphaShuffleLo = _mm_setr_epi8(3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+	const __m128i alphaShuffleHi = _mm_setr_epi8(11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1);
+	const __m128i full16 = _mm_set1_epi16(0xff);
+
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		int maskBytes;
+		memcpy(&maskBytes, mask + i, sizeof(maskBytes));
+		const __m128i m = _mm_cvtsi32_si128(maskBytes);
+		const __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(outline + i));
+
+		const __m128i tintLo = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleLo));
+		const __m128i tintHi = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleHi));
+		const __m128i inverseAlphaLo = _mm_sub_epi16(full16, _mm_shuffle_epi8(o, alphaShuffleLo));
+		const __m128i inverseAlphaHi = _mm_sub_epi16(full16, _mm_shuffle_epi8(o, alphaShuffleHi));
+		const __m128i resultLo = _mm_add_epi16(_mm_unpacklo_epi8(o, zero), byteMulSse(tintLo, inverseAlphaLo));
+		const __m128i resultHi = _mm_add_epi16(_mm_unpackhi_epi8(o, zero), byteMulSse(tintHi, inverseAlphaHi));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(resultLo, resultHi));
+	}
+	tintOverRowScalar(dest + i, mask + i, color, outline + i, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_SSE4_1
+static void tintRowSse41(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+	const __m128i maskShuffleLo = _mm_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+	const __m128i maskShuffleHi = _mm_setr_epi8(2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1);
+
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		int maskBytes;
+		memcpy(&maskBytes, mask + i, sizeof(maskBytes));
+		const __m128i m = _mm_cvtsi32_si128(maskBytes);
+		const __m128i tintLo = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleLo));
+		const __m128i tintHi = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleHi));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(tintLo, tintHi));
+	}
+	tintRowScalar(dest + i, mask + i, color, length - i);
+}
+
+// The tint's own alpha (16-bit lane 3 of each pixel) decides how much of dest shows through.
+RECOLOR_KERNEL_TARGET_SSE4_1
+static inline __m128i inverseAlphaOf16Sse(const __m128i x16)
+{
+	const __m128i alpha16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_sub_epi16(_mm_set1_epi16(0xff), alpha16);
+}
+
+RECOLOR_KERNEL_TARGET_SSE4_1
+static void tintAccumulateRowSse41(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+	const __m128i maskShuffleLo = _mm_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+	const __m128i maskShuffleHi = _mm_setr_epi8(2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1);
+
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		int maskBytes;
+		memcpy(&maskBytes, mask + i, sizeof(maskBytes));
+		const __m128i m = _mm_cvtsi32_si128(maskBytes);
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dest + i));
+
+		const __m128i tintLo = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleLo));
+		const __m128i tintHi = byteMulSse(color16, _mm_shuffle_epi8(m, maskShuffleHi));
+		const __m128i resultLo = _mm_add_epi16(tintLo, byteMulSse(_mm_unpacklo_epi8(d, zero), inverseAlphaOf16Sse(tintLo)));
+		const __m128i resultHi = _mm_add_epi16(tintHi, byteMulSse(_mm_unpackhi_epi8(d, zero), inverseAlphaOf16Sse(tintHi)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(resultLo, resultHi));
+	}
+	tintAccumulateRowScalar(dest + i, mask + i, color, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_SSE4_1
+static void overRowSse41(quint32 *dest, const quint32 *outline, const int length)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(outline + i));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dest + i));
+		const __m128i outlineLo = _mm_unpacklo_epi8(o, zero);
+		const __m128i outlineHi = _mm_unpackhi_epi8(o, zero);
+		const __m128i resultLo = _mm_add_epi16(outlineLo, byteMulSse(_mm_unpacklo_epi8(d, zero), inverseAlphaOf16Sse(outlineLo)));
+		const __m128i resultHi = _mm_add_epi16(outlineHi, byteMulSse(_mm_unpackhi_epi8(d, zero), inverseAlphaOf16Sse(outlineHi)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(resultLo, resultHi));
+	}
+	overRowScalar(dest + i, outline + i, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_AVX2
+static inline __m256i byteMulAvx2(const __m256i x16, const __m256i a16)
+{
+	const __m256i t = _mm256_mullo_epi16(x16, a16);
+	return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), _mm256_set1_epi16(0x80)), 8);
+}
+
+// Eight pixels per step. AVX2 unpack/pack work within each 128-bit lane, so the low half of the
+// unpacked registers holds pixels 0, 1 | 4, 5 and the high half 2, 3 | 6, 7; the mask shuffles follow suit.
+RECOLOR_KERNEL_TARGET_AVX2
+static void tintOverRowAvx2(quint32 *dest, const uchar *mask, const quint32 color, const quint32 *outline, const int length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(color)), zero);
+	const __m256i maskShuffleLo = _mm256_setr_epi8(
+		0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+		4, -1, 4, -1, 4, -1, 4, -1, 5, -1, 5, -1, 5, -1, 5, -1);
+	const __m256i maskShuffleHi = _mm256_setr_epi8(
+		2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1,
+		6, -1, 6, -1, 6, -1, 6, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+	const __m256i alphaShuffleLo = _mm256_setr_epi8(
+		3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1,
+		3, -1, 3, -1, 3, -1, 3, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+	const __m256i alphaShuffleHi = _mm256_setr_epi8(
+		11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1,
+		11, -1, 11, -1, 11, -1, 11, -1, 15, -1, 15, -1, 15, -1, 15, -1);
+	const __m256i full16 = _mm256_set1_epi16(0xff);
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const __m256i m = _mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i)));
+		const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(outline + i));
+
+		const __m256i tintLo = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleLo));
+		const __m256i tintHi = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleHi));
+		const __m256i inverseAlphaLo = _mm256_sub_epi16(full16, _mm256_shuffle_epi8(o, alphaShuffleLo));
+		const __m256i inverseAlphaHi = _mm256_sub_epi16(full16, _mm256_shuffle_epi8(o, alphaShuffleHi));
+		const __m256i resultLo = _mm256_add_epi16(_mm256_unpacklo_epi8(o, zero), byteMulAvx2(tintLo, inverseAlphaLo));
+		const __m256i resultHi = _mm256_add_epi16(_mm256_unpackhi_epi8(o, zero), byteMulAvx2(tintHi, inverseAlphaHi));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_packus_epi16(resultLo, resultHi));
+	}
+	tintOverRowSse41(dest + i, mask + i, color, outline + i, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_AVX2
+static void tintRowAvx2(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(color)), zero);
+	const __m256i maskShuffleLo = _mm256_setr_epi8(
+		0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+		4, -1, 4, -1, 4, -1, 4, -1, 5, -1, 5, -1, 5, -1, 5, -1);
+	const __m256i maskShuffleHi = _mm256_setr_epi8(
+		2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1,
+		6, -1, 6, -1, 6, -1, 6, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const __m256i m = _mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i)));
+		const __m256i tintLo = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleLo));
+		const __m256i tintHi = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleHi));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_packus_epi16(tintLo, tintHi));
+	}
+	tintRowSse41(dest + i, mask + i, color, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_AVX2
+static inline __m256i inverseAlphaOf16Avx2(const __m256i x16)
+{
+	const __m256i alpha16 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm256_sub_epi16(_mm256_set1_epi16(0xff), alpha16);
+}
+
+RECOLOR_KERNEL_TARGET_AVX2
+static void tintAccumulateRowAvx2(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(color)), zero);
+	const __m256i maskShuffleLo = _mm256_setr_epi8(
+		0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+		4, -1, 4, -1, 4, -1, 4, -1, 5, -1, 5, -1, 5, -1, 5, -1);
+	const __m256i maskShuffleHi = _mm256_setr_epi8(
+		2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1,
+		6, -1, 6, -1, 6, -1, 6, -1, 7, -1, 7, -1, 7, -1, 7, -1);
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const __m256i m = _mm256_broadcastq_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i)));
+		const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dest + i));
+
+		const __m256i tintLo = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleLo));
+		const __m256i tintHi = byteMulAvx2(color16, _mm256_shuffle_epi8(m, maskShuffleHi));
+		const __m256i resultLo = _mm256_add_epi16(tintLo, byteMulAvx2(_mm256_unpacklo_epi8(d, zero), inverseAlphaOf16Avx2(tintLo)));
+		const __m256i resultHi = _mm256_add_epi16(tintHi, byteMulAvx2(_mm256_unpackhi_epi8(d, zero), inverseAlphaOf16Avx2(tintHi)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_packus_epi16(resultLo, resultHi));
+	}
+	tintAccumulateRowSse41(dest + i, mask + i, color, length - i);
+}
+
+RECOLOR_KERNEL_TARGET_AVX2
+static void overRowAvx2(quint32 *dest, const quint32 *outline, const int length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(outline + i));
+		const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dest + i));
+		const __m256i outlineLo = _mm256_unpacklo_epi8(o, zero);
+		const __m256i outlineHi = _mm256_unpackhi_epi8(o, zero);
+		const __m256i resultLo = _mm256_add_epi16(outlineLo, byteMulAvx2(_mm256_unpacklo_epi8(d, zero), inverseAlphaOf16Avx2(outlineLo)));
+		const __m256i resultHi = _mm256_add_epi16(outlineHi, byteMulAvx2(_mm256_unpackhi_epi8(d, zero), inverseAlphaOf16Avx2(outlineHi)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_packus_epi16(resultLo, resultHi));
+	}
+	overRowSse41(dest + i, outline + i, length - i);
+}
+
+static bool cpuSupports(RecolorKernel::InstructionSet instructionSet)
+{
+	int info1[4] = { 0, 0, 0, 0 };
+	int info7[4] = { 0, 0, 0, 0 };
+	unsigned long long xcr0 = 0;
+#if defined(_MSC_VER)
+	__cpuid(info1, 1);
+	__cpuidex(info7, 7, 0);
+	const bool osxsave = (info1[2] & (1 << 27)) != 0;
+	if (osxsave)
+		xcr0 = _xgetbv(0);
+#else
+	unsigned int a, b, c, d;
+	if (__get_cpuid(1, &a, &b, &c, &d))
+	{
+		info1[0] = a; info1[1] = b; info1[2] = c; info1[3] = d;
+	}
+	if (__get_cpuid_count(7, 0, &a, &b, &c, &d))
+	{
+		info7[0] = a; info7[1] = b; info7[2] = c; info7[3] = d;
+	}
+	const bool osxsave = (info1[2] & (1 << 27)) != 0;
+	if (osxsave)
+	{
+		unsigned int xcr0Lo, xcr0Hi;
+		__asm__ volatile("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+		xcr0 = (static_cast<unsigned long long>(xcr0Hi) << 32) | xcr0Lo;
+	}
+#endif
+
+	const bool sse41 = (info1[2] & (1 << 19)) != 0;
+	const bool avx = (info1[2] & (1 << 28)) != 0 && osxsave && (xcr0 & 0x6) == 0x6; // OS saves XMM and YMM state.
+	const bool avx2 = avx && (info7[1] & (1 << 5)) != 0;
+
+	if (instructionSet == RecolorKernel::InstructionSet::AVX2)
+		return avx2;
+	else if (instructionSet == RecolorKernel::InstructionSet::SSE4_1)
+		return sse41;
+	return false;
+}
+
+#endif // RECOLOR_KERNEL_X86
+
+#if defined(RECOLOR_KERNEL_NEON)
+
+// vsraq_n_u16(t, t, 8) is t + (t >> 8), and vrshrn_n_u16(x, 8) is (x + 0x80) >> 8 narrowed back to bytes.
+static inline uint8x8_t byteMulNeon(const uint8x8_t x, const uint8x8_t a)
+{
+	const uint16x8_t t = vmull_u8(x, a);
+	return vrshrn_n_u16(vsraq_n_u16(t, t, 8), 8);
+}
+
+// Eight pixels per step, split into per-channel vectors (B, G, R, A in memory order) by vld4.
+static void tintOverRowNeon(quint32 *dest, const uchar *mask, const quint32 color, const quint32 *outline, const int length)
+{
+	const uint8x8_t colorB = vdup_n_u8(static_cast<uint8_t>(color));
+	const uint8x8_t colorG = vdup_n_u8(static_cast<uint8_t>(color >> 8));
+	const uint8x8_t colorR = vdup_n_u8(static_cast<uint8_t>(color >> 16));
+	const uint8x8_t colorA = vdup_n_u8(static_cast<uint8_t>(color >> 24));
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const uint8x8_t m = vld1_u8(mask + i);
+		const uint8x8x4_t o = vld4_u8(reinterpret_cast<const uint8_t*>(outline + i));
+		const uint8x8_t inverseAlpha = vmvn_u8(o.val[3]);
+		uint8x8x4_t result;
+		result.val[0] = vadd_u8(o.val[0], byteMulNeon(byteMulNeon(colorB, m), inverseAlpha));
+		result.val[1] = vadd_u8(o.val[1], byteMulNeon(byteMulNeon(colorG, m), inverseAlpha));
+		result.val[2] = vadd_u8(o.val[2], byteMulNeon(byteMulNeon(colorR, m), inverseAlpha));
+		result.val[3] = vadd_u8(o.val[3], byteMulNeon(byteMulNeon(colorA, m), inverseAlpha));
+		vst4_u8(reinterpret_cast<uint8_t*>(dest + i), result);
+	}
+	tintOverRowScalar(dest + i, mask + i, color, outline + i, length - i);
+}
+
+static void tintRowNeon(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const uint8x8_t colorB = vdup_n_u8(static_cast<uint8_t>(color));
+	const uint8x8_t colorG = vdup_n_u8(static_cast<uint8_t>(color >> 8));
+	const uint8x8_t colorR = vdup_n_u8(static_cast<uint8_t>(color >> 16));
+	const uint8x8_t colorA = vdup_n_u8(static_cast<uint8_t>(color >> 24));
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const uint8x8_t m = vld1_u8(mask + i);
+		uint8x8x4_t result;
+		result.val[0] = byteMulNeon(colorB, m);
+		result.val[1] = byteMulNeon(colorG, m);
+		result.val[2] = byteMulNeon(colorR, m);
+		result.val[3] = byteMulNeon(colorA, m);
+		vst4_u8(reinterpret_cast<uint8_t*>(dest + i), result);
+	}
+	tintRowScalar(dest + i, mask + i, color, length - i);
+}
+
+static void tintAccumulateRowNeon(quint32 *dest, const uchar *mask, const quint32 color, const int length)
+{
+	const uint8x8_t colorB = vdup_n_u8(static_cast<uint8_t>(color));
+	const uint8x8_t colorG = vdup_n_u8(static_cast<uint8_t>(color >> 8));
+	const uint8x8_t colorR = vdup_n_u8(static_cast<uint8_t>(color >> 16));
+	const uint8x8_t colorA = vdup_n_u8(static_cast<uint8_t>(color >> 24));
+
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const uint8x8_t m = vld1_u8(mask + i);
+		uint8x8x4_t d = vld4_u8(reinterpret_cast<const uint8_t*>(dest + i));
+		const uint8x8_t tintA = byteMulNeon(colorA, m);
+		const uint8x8_t inverseAlpha = vmvn_u8(tintA);
+		d.val[0] = vadd_u8(byteMulNeon(colorB, m), byteMulNeon(d.val[0], inverseAlpha));
+		d.val[1] = vadd_u8(byteMulNeon(colorG, m), byteMulNeon(d.val[1], inverseAlpha));
+		d.val[2] = vadd_u8(byteMulNeon(colorR, m), byteMulNeon(d.val[2], inverseAlpha));
+		d.val[3] = vadd_u8(tintA, byteMulNeon(d.val[3], inverseAlpha));
+		vst4_u8(reinterpret_cast<uint8_t*>(dest + i), d);
+	}
+	tintAccumulateRowScalar(dest + i, mask + i, color, length - i);
+}
+
+static void overRowNeon(quint32 *dest, const quint32 *outline, const int length)
+{
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		const uint8x8x4_t o = vld4_u8(reinterpret_cast<const uint8_t*>(outline + i));
+		uint8x8x4_t d = vld4_u8(reinterpret_cast<const uint8_t*>(dest + i));
+		const uint8x8_t inverseAlpha = vmvn_u8(o.val[3]);
+		for (int channel = 0; channel < 4; channel++)
+			d.val[channel] = vadd_u8(o.val[channel], byteMulNeon(d.val[channel], inverseAlpha));
+		vst4_u8(reinterpret_cast<uint8_t*>(dest + i), d);
+	}
+	overRowScalar(dest + i, outline + i, length - i);
+}
+
+#endif // RECOLOR_KERNEL_NEON
+
+QImage RecolorKernel::tint(const QImage &mask, const QColor &color, const QImage &outline, const QRect &rect)
+{
+	if (mask.isNull())
+		return QImage();
+
+	const QImage maskAlpha = mask.format() == QImage::Format_Alpha8 ? mask : mask.convertToFormat(QImage::Format_Alpha8);
+	const QRect area = rect.isNull() ? maskAlpha.rect() : rect;
+	if (area.isEmpty())
+		return emptyLayer();
+
+	QImage outlinePremultiplied;
+	if (!outline.isNull())
+	{
+		outlinePremultiplied = outline.format() == QImage::Format_ARGB32_Premultiplied
+			? outline
+			: outline.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	}
+
+	const rowFuncData &funcs = rowFuncs();
+	const quint32 colorPremultiplied = premultipliedColor(color);
+	const QRect maskArea = area.intersected(maskAlpha.rect());
+	const int outlineWidth = std::min(maskAlpha.width(), outlinePremultiplied.width());
+	const int outlineHeight = std::min(maskAlpha.height(), outlinePremultiplied.height());
+
+	QImage result(area.size(), QImage::Format_ARGB32_Premultiplied);
+	if (maskArea != area)
+		result.fill(0);
+	if (maskArea.isEmpty())
+		return result;
+
+	// The outline covers a prefix of each row (it's placed at the same origin as the mask),
+	// so each row is at most one fused tint + outline run followed by a plain tint run.
+	const int length = maskArea.width();
+	const int overlap = std::max(0, std::min(outlineWidth - maskArea.left(), length));
+	for (int y = maskArea.top(); y <= maskArea.bottom(); y++)
+	{
+		quint32 *destLine = reinterpret_cast<quint32*>(result.scanLine(y - area.top())) + (maskArea.left() - area.left());
+		const uchar *maskLine = maskAlpha.constScanLine(y) + maskArea.left();
+		int x = 0;
+		if (y < outlineHeight && overlap > 0)
+		{
+			const quint32 *outlineLine = reinterpret_cast<const quint32*>(outlinePremultiplied.constScanLine(y)) + maskArea.left();
+			funcs.tintOverRow(destLine, maskLine, colorPremultiplied, outlineLine, overlap);
+			x = overlap;
+		}
+		funcs.tintRow(destLine + x, maskLine + x, colorPremultiplied, length - x);
+	}
+	return result;
+}
+
+QImage RecolorKernel::composite(const QSize &size, const std::vector<layerData> &layers, const QImage &outline, const QRect &rect)
+{
+	const QRect canvasRect(QPoint(0, 0), size);
+	const QRect area = rect.isNull() ? canvasRect : rect;
+	if (size.isEmpty() || area.isEmpty())
+		return emptyLayer();
+
+	struct preparedLayerData
+	{
+		QImage mask;
+		quint32 color;
+		QRect bounds;
+	};
+
+	// Clip each layer's bounds to the canvas and the area being made up front, and drop layers that have nothing to draw.
+	const QRect drawRect = area.intersected(canvasRect);
+	std::vector<preparedLayerData> preparedLayers;
+	for (const auto& layer : layers)
+	{
+		if (layer.mask.isNull())
+			continue;
+		const QImage maskAlpha = layer.mask.format() == QImage::Format_Alpha8 ? layer.mask : layer.mask.convertToFormat(QImage::Format_Alpha8);
+		const QRect bounds = layer.bounds.intersected(drawRect).intersected(maskAlpha.rect());
+		if (bounds.isEmpty())
+			continue;
+		preparedLayers.emplace_back(preparedLayerData{ maskAlpha, premultipliedColor(layer.color), bounds });
+	}
+
+	QImage outlinePremultiplied;
+	if (!outline.isNull())
+	{
+		outlinePremultiplied = outline.format() == QImage::Format_ARGB32_Premultiplied
+			? outline
+			: outline.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	}
+
+	const rowFuncData &funcs = rowFuncs();
+	const QRect outlineRect = drawRect.intersected(outlinePremultiplied.rect());
+
+	// Each output row is cleared, has every layer that reaches it blended in, then gets the outline,
+	// so the row stays in cache for the whole stack however many layers there are.
+	QImage result(area.size(), QImage::Format_ARGB32_Premultiplied);
+	for (int y = area.top(); y <= area.bottom(); y++)
+	{
+		quint32 *destLine = reinterpret_cast<quint32*>(result.scanLine(y - area.top()));
+		memset(destLine, 0, static_cast<size_t>(area.width()) * sizeof(quint32));
+		for (const auto& layer : preparedLayers)
+		{
+			if (y < layer.bounds.top() || y > layer.bounds.bottom())
+				continue;
+			const int left = layer.bounds.left();
+			funcs.tintAccumulateRow(destLine + (left - area.left()), layer.mask.constScanLine(y) + left, layer.color, layer.bounds.width());
+		}
+		if (!outlineRect.isEmpty() && y >= outlineRect.top() && y <= outlineRect.bottom())
+		{
+			const int left = outlineRect.left();
+			funcs.overRow
+			(
+				destLine + (left - area.left()),
+				reinterpret_cast<const quint32*>(outlinePremultiplied.constScanLine(y)) + left,
+				outlineRect.width()
+			);
+		}
+	}
+	return result;
+}
+
+QImage RecolorKernel::emptyLayer()
+{
+	QImage empty(1, 1, QImage::Format_ARGB32_Premultiplied);
+	empty.fill(0);
+	return empty;
+}
+
+// Smallest rect holding every pixel with non-zero alpha. Anything outside it tints to fully transparent,
+// which leaves whatever is under it unchanged, so it can be skipped when compositing.
+QRect RecolorKernel::alphaBounds(const QImage &mask)
+{
+	const QImage maskAlpha = mask.format() == QImage::Format_Alpha8 ? mask : mask.convertToFormat(QImage::Format_Alpha8);
+	int left = maskAlpha.width();
+	int right = -1;
+	int top = -1;
+	int bottom = -1;
+	for (int y = 0; y < maskAlpha.height(); y++)
+	{
+		const uchar *line = maskAlpha.constScanLine(y);
+		int first = 0;
+		while (first < maskAlpha.width() && line[first] == 0)
+			first++;
+		if (first == maskAlpha.width())
+			continue;
+		int last = maskAlpha.width() - 1;
+		while (line[last] == 0)
+			last--;
+		if (top == -1)
+			top = y;
+		bottom = y;
+		left = std::min(left, first);
+		right = std::max(right, last);
+	}
+	if (top == -1)
+		return QRect();
+	return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+RecolorKernel::InstructionSet RecolorKernel::instructionSet()
+{
+	return rowFuncs().instructionSet;
+}
+
+// Matches how QPainter turns a fill color into the solid color it blends with
+// (premultiplied at 16 bits per channel, then rounded down to 8).
+quint32 RecolorKernel::premultipliedColor(const QColor &color)
+{
+	return qPremultiply(color.rgba64()).toArgb32();
+}
+
+const RecolorKernel::rowFuncData& RecolorKernel::rowFuncs()
+{
+	static const rowFuncData funcs = detectRowFuncs();
+	return funcs;
+}
+
+RecolorKernel::rowFuncData RecolorKernel::detectRowFuncs()
+{
+#if defined(RECOLOR_KERNEL_X86)
+	if (cpuSupports(InstructionSet::AVX2))
+		return rowFuncData{ InstructionSet::AVX2, tintRowAvx2, tintOverRowAvx2, tintAccumulateRowAvx2, overRowAvx2 };
+	if (cpuSupports(InstructionSet::SSE4_1))
+		return rowFuncData{ InstructionSet::SSE4_1, tintRowSse41, tintOverRowSse41, tintAccumulateRowSse41, overRowSse41 };
+#elif defined(RECOLOR_KERNEL_NEON)
+	return rowFuncData{ InstructionSet::NEON, tintRowNeon, tintOverRowNeon, tintAccumulateRowNeon, overRowNeon };
+#endif
+	return rowFuncData{ InstructionSet::SCALAR, tintRowScalar, tintOverRowScalar, tintAccumulateRowScalar, overRowScalar };
+}
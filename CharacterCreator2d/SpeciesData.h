@@ -0,0 +1,187 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include "theme.h"
+#include "PixmapItemAnimatable.h"
+#include "FlatStorage.h"
+#include "IconButton.h"
+#include <map>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <QString>
+#include <QColor>
+#include <QRect>
+#include <QStringList>
+#include <QHash>
+#include <QWidget>
+#include <QGridLayout>
+#include <QGraphicsItemGroup>
+#include <QMenu>
+#include <QAction>
+#include <QTimer>
+#include <QPropertyAnimation>
+#include <QEasingCurve>
+#include <QFutureWatcher>
+#include <QImage>
+
+// The speciesMap hierarchy GraphicsDisplay builds from the asset index at startup: the per-asset and per-component
+// editing state, plus the buttons, menus, scene items and animations that show it.
+// Everything that can be set without widgets (the enums, component settings, etc.) is in theme.h, so code that
+// only works with the asset index or with character images (see CharacterCompositor) doesn't pull in QtWidgets.
+
+// With subcolors, we allow assets to be split up into different "fill" image parts that can be recolored individually.
+// Any assets that are NOT split up are ignored by subcolor code and recolored as normal.
+// Folder structure and placement of images in them determines whether an asset is split up, which means there are no
+// built-in limits to the number of "fill" parts for a specific image. It is worth considering in design, though, that
+// too many parts may be a pain for the user to recolor.
+struct subColorData
+{
+	const QString imgFilename; // We use this for saving/loading by filename of an img part.
+	const QString imgPath;
+	const QColor colorDefault;
+	QColor colorAltered;
+	const QRect alphaBounds; // Non-transparent area of the image, from the asset index.
+};
+
+struct animationFrameData
+{
+	const QString imgOutlinePath; // The outline image for the animation frame.
+	QString imgFillPath; // If empty, we use default fill for animation, but alternate can be specified by frame here.
+};
+
+struct animationPropertyData
+{
+	const QStringList animationSequence; // Sequence of frames (which can be repeating, ex: 1, 2, 3, 2, 1).
+	const int duration; // How long the animation lasts in milliseconds.
+	const bool animateOutline; // Whether outline frames should be looked for and animated.
+	const bool animateFill; // Whether fill frames should be looked for and animated.
+	const bool repeating; // Whether animation should be repeating (ex: blinking eyes), or only play once when triggered.
+	const std::pair<int, int> repeatingTimeRange; // How frequently animation should repeat in random range.
+	const QEasingCurve::Type easingCurve; // See QEasingCurve documentation for details. Default is linear.
+};
+
+// Only assets with an animation folder get one of these.
+struct assetAnimationData
+{
+	const animationPropertyData properties;
+	std::vector<animationFrameData> frameList; // Image frames for the animation.
+	std::unique_ptr<QPropertyAnimation> animation = std::make_unique<QPropertyAnimation>();
+};
+
+// The mostly read-only description of an asset. State that changes while editing is kept per component
+// (see componentData), and the animation hangs off a side pointer, so an asset that isn't animated
+// doesn't pay for an animation object or frame list.
+struct assetsData
+{
+	const int slot; // Where this asset's state sits in its componentData's per-asset lists.
+	const QString imgFilename; // We use this for saving/loading by filename of an img part.
+	const QString imgFillPath; // This is the part that is affected by color changes.
+	const QString imgOutlinePath; // Outline for related fill img. Assets with no color change use Outline only (no fill).
+	const QString imgThumbnailPath; // The thumbnail for showing the asset in the swap UI.
+	const QPoint relativePos; // Where asset should go in the scene, relative to the character frame size.
+	const QRect alphaBounds; // Non-transparent area across every image the asset draws (incl. animation frames). Layers are cropped to it.
+	InternedTable<subColorData> subColorsMap; // Keyed by interned sub-color name.
+	QStringList subColorsKeyList; // Used to quickly populate the dropdown list.
+	std::unique_ptr<assetAnimationData> animationData; // Null unless the asset is animated.
+};
+
+struct componentData
+{
+	InternedTable<assetsData> assetsMap; // Keyed by interned asset folder name.
+	int displayedAssetId = StringInterner::invalidId;
+
+	// Colors are held per component rather than per asset: every asset shows colorShared unless a color was changed
+	// for just that asset, in which case it has its own entry in colorOverrideMap. "Apply color to all in set"
+	// (and carrying a color across a pose switch) is then one write, however many assets the component has.
+	// Color changes are applied to the scene on part swap.
+	QColor colorShared;
+	QHash<int, QColor> colorOverrideMap; // Keyed by assetsData::slot.
+
+	// Per-asset editing state, as a list indexed by assetsData::slot.
+	std::vector<bool> chosenList; // Whether the asset's swap button shows as chosen.
+
+	QColor colorAltered(const assetsData &asset) const { return colorOverrideMap.value(asset.slot, colorShared); }
+	void setColorAltered(const assetsData &asset, const QColor &color) { colorOverrideMap.insert(asset.slot, color); }
+	void setColorAlteredAll(const QColor &color) { colorShared = color; colorOverrideMap.clear(); }
+	bool chosen(const assetsData &asset) const { return chosenList[asset.slot]; }
+	void clearChosen() { std::fill(chosenList.begin(), chosenList.end(), false); }
+};
+
+// What a worker hands back for one recolor job. A job whose request was superseded before it ran
+// paints nothing and is flagged, so it's never mistaken for a layer (an empty layer is a valid result).
+struct recolorResultData
+{
+	QImage layer;
+	bool superseded = false;
+};
+
+struct componentUiData
+{
+	const componentDataSettings settings;
+	const int assetStrId; // Interned settings.assetStr, for matching save file lines.
+	std::unique_ptr<PixmapItemAnimatable> item = std::make_unique<PixmapItemAnimatable>(nullptr);
+	std::unique_ptr<IconButton> btnSwapComponent = std::make_unique<IconButton>(nullptr);
+	std::unique_ptr<IconButton> btnPickColor = std::make_unique<IconButton>(nullptr);
+	std::unique_ptr<QMenu> contextMenuForBtnPickColor = std::make_unique<QMenu>();
+	std::unique_ptr<QAction> actionCopyColor = std::make_unique<QAction>("Copy Color");
+	std::unique_ptr<QAction> actionPasteColor = std::make_unique<QAction>("Paste Color");
+	std::unique_ptr<QAction> actionApplyColorToAllInSet = std::make_unique<QAction>("Apply Current Color to All In Set");
+	std::unique_ptr<QTimer> animationRepeatingTimer = std::make_unique<QTimer>();
+	std::unique_ptr<QFutureWatcher<recolorResultData>> recolorWatcher = std::make_unique<QFutureWatcher<recolorResultData>>(); // Layers being recolored off the GUI thread.
+	std::unique_ptr<std::atomic<quint64>> recolorGeneration = std::make_unique<std::atomic<quint64>>(0); // Bumped on every recolor request for the part.
+
+	// Every component whose color follows this one's, directly or through others, in the order to apply it
+	// (a component always comes after the ones it's bound through). Built once per species from the settings'
+	// Dom/Sub lists, so a color change is one pass over this list (see propagateSharedColor).
+	std::vector<ComponentType> sharedColoringBoundList;
+};
+
+struct poseData
+{
+	const QString assetStr;
+	EnumTable<ComponentType, componentData, componentTypeCount> componentMap;
+	std::map<ComponentType, int> displayOrderZOverrideMap;
+	std::unique_ptr<QAction> actionPose = std::make_unique<QAction>();
+	bool materialized = false; // componentMap stays empty until the pose is first used.
+};
+
+struct genderData
+{
+	const QString assetStr;
+	EnumTable<PoseType, poseData, poseTypeCount> poseMap;
+	std::unique_ptr<QAction> actionGender = std::make_unique<QAction>();
+};
+
+struct speciesData
+{
+	const QString assetStr;
+
+	// The species' swap/picker buttons and scene layers, put together once at startup. Switching species just
+	// changes which panels the stacks show and which layer group is visible, so nothing is re-laid out.
+	// Declared ahead of componentUiMap so the buttons and items are destroyed before their containers.
+	std::unique_ptr<QWidget> swapPanel = std::make_unique<QWidget>(nullptr);
+	std::unique_ptr<QGridLayout> swapPanelLayout = std::make_unique<QGridLayout>();
+	std::unique_ptr<QWidget> pickerPanel = std::make_unique<QWidget>(nullptr);
+	std::unique_ptr<QGridLayout> pickerPanelLayout = std::make_unique<QGridLayout>();
+	std::unique_ptr<QGraphicsItemGroup> sceneLayers = std::make_unique<QGraphicsItemGroup>(nullptr);
+
+	EnumTable<ComponentType, componentUiData, componentTypeCount> componentUiMap;
+	QHash<int, ComponentType> componentByAssetStrId; // Interned settings.assetStr -> component, for matching save file lines.
+	EnumTable<GenderType, genderData, genderTypeCount> genderMap;
+	std::unique_ptr<QAction> actionSpecies = std::make_unique<QAction>();
+};
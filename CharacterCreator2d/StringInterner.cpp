@@ -0,0 +1,51 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "StringInterner.h"
+
+int StringInterner::intern(const QString &str)
+{
+	auto found = idMap.constFind(str);
+	if (found != idMap.constEnd())
+		return found.value();
+	const int newId = static_cast<int>(strList.size());
+	strList.emplace_back(str);
+	idMap.insert(str, newId);
+	return newId;
+}
+
+int StringInterner::id(const QString &str) const
+{
+	return idMap.value(str, invalidId);
+}
+
+const QString& StringInterner::str(const int id) const
+{
+	static const QString emptyStr;
+	if (id < 0 || id >= static_cast<int>(strList.size()))
+		return emptyStr;
+	return strList[id];
+}
+
+int StringInterner::count() const
+{
+	return static_cast<int>(strList.size());
+}
+
+StringInterner& internedNames()
+{
+	static StringInterner interner;
+	return interner;
+}
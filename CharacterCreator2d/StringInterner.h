@@ -0,0 +1,42 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include <QString>
+#include <QHash>
+#include <vector>
+
+// Hands out small integer IDs for the names the character model is keyed by
+// (asset folder names, sub-color names, component asset strings like "Head"), so the model compares
+// and looks up ints instead of strings. Strings only come back out at the UI and file boundaries.
+// IDs are only meaningful within a run; anything written to disk uses the strings.
+// Interning happens while the asset index is merged into the model, on the GUI thread, so there's no locking.
+class StringInterner
+{
+public:
+	static const int invalidId = -1;
+
+	int intern(const QString &str);
+	int id(const QString &str) const; // invalidId if the string was never interned.
+	const QString& str(const int id) const;
+	int count() const;
+
+private:
+	QHash<QString, int> idMap;
+	std::vector<QString> strList;
+};
+
+// The one table shared by the whole model.
+StringInterner& internedNames();
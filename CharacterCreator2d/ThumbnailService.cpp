@@ -0,0 +1,151 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "ThumbnailService.h"
+
+namespace
+{
+	class ThumbnailJob : public QRunnable
+	{
+	public:
+		ThumbnailJob(const std::function<void()> &work)
+			: work(work)
+		{
+
+		}
+		void run() override { work(); }
+
+	private:
+		const std::function<void()> work;
+	};
+}
+
+ThumbnailService::ThumbnailService(const QString &diskCachePath, QObject *parent)
+	: QObject(parent), diskCachePath(diskCachePath)
+{
+	pixmapMap.setMaxCost(static_cast<int>(memoryByteBudget / 1024));
+	QDir().mkpath(diskCachePath);
+
+	// A couple of threads is plenty for small decodes, and leaves the global pool free for recoloring.
+	threadPool.setMaxThreadCount(2);
+
+	// Pruning lists the whole cache folder, so it's done off the GUI thread, ahead of any thumbnail.
+	threadPool.start(new ThumbnailJob([diskCachePath, byteBudget = diskByteBudget]() {
+		pruneDiskCache(diskCachePath, byteBudget);
+	}), std::numeric_limits<int>::max());
+}
+
+ThumbnailService::~ThumbnailService()
+{
+	// Queued jobs are dropped and running ones finish before we go, since they post back to this object.
+	threadPool.clear();
+	threadPool.waitForDone();
+}
+
+bool ThumbnailService::find(const QString &imgPath, const QSize &size, const qreal devicePixelRatio, QPixmap &thumbnail)
+{
+	const QSize pixelSize = size * devicePixelRatio;
+	const QString key = imgPath + QString("@%1x%2").arg(pixelSize.width()).arg(pixelSize.height());
+	if (QPixmap *found = pixmapMap.object(key))
+	{
+		thumbnail = *found;
+		return true;
+	}
+	if (pendingKeySet.contains(key))
+		return false;
+	pendingKeySet.insert(key);
+
+	// Disk cache files are named by the source's path, modified time and the decode size,
+	// so an edited thumbnail or a different button size is never served stale.
+	// Resource images (ex: the error image) are already in memory, so they skip the disk cache.
+	QString diskFilePath;
+	const QFileInfo imgInfo(imgPath);
+	if (!imgPath.startsWith(":"))
+	{
+		const QByteArray diskKey = (key + QString::number(imgInfo.lastModified().toMSecsSinceEpoch())).toUtf8();
+		diskFilePath = diskCachePath + "/" + QString::fromLatin1(QCryptographicHash::hash(diskKey, QCryptographicHash::Md5).toHex()) + ".png";
+	}
+
+	// Newer requests run first, so the rows currently on screen come ahead of ones already scrolled past.
+	threadPool.start(new ThumbnailJob([this, key, imgPath, pixelSize, diskFilePath, devicePixelRatio]() {
+		const QImage image = load(imgPath, pixelSize, diskFilePath);
+		QMetaObject::invokeMethod(this, [this, key, image, devicePixelRatio]() {
+			finish(key, image, devicePixelRatio);
+		}, Qt::QueuedConnection);
+	}), ++requestCount);
+	return false;
+}
+
+// GUI thread: QPixmaps can only be made here.
+void ThumbnailService::finish(const QString &key, const QImage &image, const qreal devicePixelRatio)
+{
+	pendingKeySet.remove(key);
+	QPixmap *thumbnail = new QPixmap(QPixmap::fromImage(image));
+	thumbnail->setDevicePixelRatio(devicePixelRatio);
+	const qint64 bytes = static_cast<qint64>(image.width()) * image.height() * 4;
+	pixmapMap.insert(key, thumbnail, static_cast<int>(std::max<qint64>(1, bytes / 1024)));
+	emit thumbnailReady();
+}
+
+// Worker thread: only touches its arguments.
+QImage ThumbnailService::load(const QString &imgPath, const QSize &pixelSize, const QString &diskFilePath)
+{
+	if (!diskFilePath.isEmpty() && QFileInfo(diskFilePath).exists())
+	{
+		const QImage cached(diskFilePath);
+		if (!cached.isNull())
+		{
+			// Marks the file as used, so pruning keeps it over ones that haven't been shown in a while.
+			QFile cachedFile(diskFilePath);
+			if (cachedFile.open(QIODevice::ReadWrite))
+				cachedFile.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+			return cached;
+		}
+	}
+
+	QImageReader reader(imgPath);
+	const QSize sourceSize = reader.size();
+	if (sourceSize.isValid())
+		reader.setScaledSize(sourceSize.scaled(pixelSize, Qt::KeepAspectRatio));
+	QImage image = reader.read();
+	if (image.isNull())
+		return image;
+
+	// Some formats ignore the scaled size, so make sure we never hand back more than was asked for.
+	if (image.width() > pixelSize.width() || image.height() > pixelSize.height())
+		image = image.scaled(pixelSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+	// QSaveFile only puts the file in place once it's complete, so a crash mid-write can't leave a truncated one.
+	if (!diskFilePath.isEmpty())
+	{
+		QSaveFile fileWrite(diskFilePath);
+		if (fileWrite.open(QIODevice::WriteOnly) && image.save(&fileWrite, "PNG"))
+			fileWrite.commit();
+	}
+	return image;
+}
+
+// Worker thread: deletes the least recently used cache files until what's left fits in byteBudget.
+void ThumbnailService::pruneDiskCache(const QString &diskCachePath, const qint64 &byteBudget)
+{
+	const QFileInfoList fileList = QDir(diskCachePath).entryInfoList({ "*.png" }, QDir::Files, QDir::Time);
+	qint64 bytesKept = 0;
+	for (const auto& fileInfo : fileList)
+	{
+		bytesKept += fileInfo.size();
+		if (bytesKept > byteBudget)
+			QFile::remove(fileInfo.filePath());
+	}
+}
@@ -0,0 +1,73 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+#include <QObject>
+#include <QString>
+#include <QSize>
+#include <QImage>
+#include <QImageReader>
+#include <QPixmap>
+#include <QCache>
+#include <QSet>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QCryptographicHash>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QMetaObject>
+#include <functional>
+#include <algorithm>
+#include <limits>
+
+// Swap panel thumbnails, decoded off the GUI thread at the size they're shown at.
+// The full-size PNG is never decoded: QImageReader scales while decoding, and the result is also written
+// to a disk cache so later launches only read a small file. Finished thumbnails are kept in memory too.
+// Until a thumbnail is ready, the caller draws a placeholder and gets thumbnailReady when it's in.
+// The disk cache is kept under a byte budget: a file's modified time is bumped whenever it's read, and at startup
+// the least recently used files past the budget are deleted, which is also how thumbnails of edited images
+// or old button sizes (whose files no longer match any key) leave the cache.
+class ThumbnailService : public QObject
+{
+	Q_OBJECT
+
+public:
+	ThumbnailService(const QString &diskCachePath, QObject *parent = nullptr);
+	~ThumbnailService();
+
+	// Returns true if the thumbnail is ready (thumbnail may still be null if the image couldn't be read).
+	// Otherwise starts loading it, if it isn't already, and returns false.
+	// size is in device-independent pixels; the thumbnail is decoded at size * devicePixelRatio.
+	bool find(const QString &imgPath, const QSize &size, const qreal devicePixelRatio, QPixmap &thumbnail);
+
+signals:
+	void thumbnailReady();
+
+private:
+	const QString diskCachePath;
+	const qint64 memoryByteBudget = 32 * 1024 * 1024;
+	const qint64 diskByteBudget = 64 * 1024 * 1024;
+	QCache<QString, QPixmap> pixmapMap; // Costs are in kilobytes, same as RecolorCache.
+	QSet<QString> pendingKeySet;
+	QThreadPool threadPool;
+	int requestCount = 0;
+
+	void finish(const QString &key, const QImage &image, const qreal devicePixelRatio);
+	static QImage load(const QString &imgPath, const QSize &pixelSize, const QString &diskFilePath);
+	static void pruneDiskCache(const QString &diskCachePath, const qint64 &byteBudget);
+};
@@ -1,16 +1,11 @@
 #pragma once
-#include "PixmapItemAnimatable.h"
 #include <map>
 #include <vector>
-#include <memory>
 #include <QString>
 #include <QColor>
+#include <QRect>
+#include <QSize>
 #include <QStringList>
-#include <QPushButton>
-#include <QGraphicsPixmapItem>
-#include <QMenu>
-#include <QAction>
-#include <QPropertyAnimation>
 
 // We define creator theme properties here that can be defined without needing information from startup.
 // For example, what are the possible species? We can define that here.
@@ -29,6 +24,13 @@ enum class PoseType { FRONT_FACING, BACK_FACING, FRONT_STANDING };
 enum class ComponentType { BODY, EYES, LIPS, BLUSH, HEAD, EARS, NECK, JACKET, CHEST, BOTTOM, FEET, MASK, HAIR, NONE };
 enum class ColorSetType { FILL_NO_OUTLINE, FILL_WITH_OUTLINE, NONE };
 
+// Sizes of the dense tables the character model is stored in (see FlatStorage.h).
+// These count on each enum's values running from 0 with no gaps, and on the last value named here staying last.
+const std::size_t speciesTypeCount = static_cast<std::size_t>(SpeciesType::ELF) + 1;
+const std::size_t genderTypeCount = static_cast<std::size_t>(GenderType::MALE) + 1;
+const std::size_t poseTypeCount = static_cast<std::size_t>(PoseType::FRONT_STANDING) + 1;
+const std::size_t componentTypeCount = static_cast<std::size_t>(ComponentType::NONE) + 1;
+
 // The size of the frame that character assets get placed/positioned in, used for relative positioning of assets.
 // Example Usage: You make a 'frame' that is the size of your character overall when the pieces are put together.
 // This size could be used for things like collision detection in a game. 
@@ -37,55 +39,12 @@ enum class ColorSetType { FILL_NO_OUTLINE, FILL_WITH_OUTLINE, NONE };
 // place them in the scene, relative to the frame.
 const QSize characterFrameSize = QSize(500, 550);
 
-// With subcolors, we allow assets to be split up into different "fill" image parts that can be recolored individually.
-// Any assets that are NOT split up are ignored by subcolor code and recolored as normal.
-// Folder structure and placement of images in them determines whether an asset is split up, which means there are no
-// built-in limits to the number of "fill" parts for a specific image. It is worth considering in design, though, that
-// too many parts may be a pain for the user to recolor.
-struct subColorData
-{
-	const QString imgFilename; // We use this for saving/loading by filename of an img part.
-	const QString imgPath;
-	const QColor colorDefault;
-	QColor colorAltered;
-};
-
-struct animationFrameData
-{
-	const QString imgOutlinePath; // The outline image for the animation frame.
-	QString imgFillPath; // If empty, we use default fill for animation, but alternate can be specified by frame here.
-};
-
-struct animationPropertyData
-{
-	const QStringList animationSequence; // Sequence of frames (which can be repeating, ex: 1, 2, 3, 2, 1).
-	const int duration; // How long the animation lasts in milliseconds.
-	const bool animateOutline; // Whether outline frames should be looked for and animated.
-	const bool animateFill; // Whether fill frames should be looked for and animated.
-	const bool repeating; // Whether animation should be repeating (ex: blinking eyes), or only play once when triggered.
-	const std::pair<int, int> repeatingTimeRange; // How frequently animation should repeat in random range.
-	const QEasingCurve::Type easingCurve; // See QEasingCurve documentation for details. Default is linear.
-};
-
-struct assetsData
-{
-	const QString imgFilename; // We use this for saving/loading by filename of an img part.
-	const QString imgFillPath; // This is the part that is affected by color changes.
-	const QString imgOutlinePath; // Outline for related fill img. Assets with no color change use Outline only (no fill).
-	const QString imgThumbnailPath; // The thumbnail for showing the asset in the swap UI.
-	const QColor colorDefault; // We revert to this when "resetting" with, for example, "new character."
-	QColor colorAltered; // Color changes are stored here and applied to the scene on part swap.
-	const QPoint relativePos; // Where asset should go in the scene, relative to the character frame size.
-	std::unique_ptr<QPushButton> btnSwapAsset = std::make_unique<QPushButton>(nullptr);
-	QString btnSwapAssetStyle;
-	QString btnSwapAssetChosenStyle;
-	bool btnAssetChosen = false;
-	std::map<QString, subColorData> subColorsMap;
-	QStringList subColorsKeyList; // Used to quickly populate the dropdown list.
-	std::vector<animationFrameData> animationFrameList; // Image frames for the animation.
-	std::vector <animationPropertyData> animationPropertiesList;
-	std::unique_ptr<QPropertyAnimation> animation = std::make_unique<QPropertyAnimation>();
-};
+// Swap/picker buttons (IconButton) and assets in the swap panel (AssetSwapDelegate) paint their own backgrounds,
+// so the colors for each state are set here.
+const QColor btnBackground = QColor("#FFFFFF");
+const QColor btnHoverBackground = QColor("#F8F1E6");
+const QColor btnChosenBackground = QColor("#E5884E");
+const QColor swapAssetPlaceholderColor = QColor("#EFEFEF"); // Shown while a thumbnail is still loading.
 
 struct componentDataSettings
 {
@@ -100,17 +59,13 @@ struct componentDataSettings
 	const ColorSetType colorSetType = ColorSetType::NONE;
 	const bool partHasBtnSwap;
 	const bool partHasBtnPickColor;
-	const QString btnStyleSheetTemplate;
-	const QString btnStyleSheetTemplateChosen;
-	const QStringList btnSwapIcons;
+	const QStringList btnSwapIcons; // Normal, hover and pressed.
 	const QStringList btnPickColorIcons;
 	const std::vector<int> gridPlacePickColor;
 	const Qt::Alignment gridAlignPickColor;
 	const std::vector<int> gridPlaceSwapComponent;
 	const Qt::Alignment gridAlignSwapComponent;
-	const std::vector<int> gridPlaceSwapAssetOrigin; // Where placement starts; the rest are incremented down as needed.
-	const Qt::Alignment gridAlignSwapAsset;
-	const int btnSwapWidth;
+	const int btnSwapWidth; // Also the size assets are shown at in the swap panel.
 	const int btnSwapHeight;
 	const int btnPickColorWidth;
 	const int btnPickColorHeight;
@@ -125,52 +80,6 @@ struct componentDataSettings
 	const std::vector<ComponentType> sharedColoringSubList;
 };
 
-struct componentData
-{
-	std::map<QString, assetsData> assetsMap;
-	QString displayedAssetKey;
-};
-
-struct componentUiData
-{
-	const componentDataSettings settings;
-	QString btnSwapComponentStyle;
-	QString btnSwapComponentChosenStyle;
-	QString btnPickColorStyle;
-	bool btnComponentChosen = false;
-	std::unique_ptr<PixmapItemAnimatable> item = std::make_unique<PixmapItemAnimatable>(nullptr);
-	std::unique_ptr<QPushButton> btnSwapComponent = std::make_unique<QPushButton>(nullptr);
-	std::unique_ptr<QPushButton> btnPickColor = std::make_unique<QPushButton>(nullptr);
-	std::unique_ptr<QMenu> contextMenuForBtnPickColor = std::make_unique<QMenu>();
-	std::unique_ptr<QAction> actionCopyColor = std::make_unique<QAction>("Copy Color");
-	std::unique_ptr<QAction> actionPasteColor = std::make_unique<QAction>("Paste Color");
-	std::unique_ptr<QAction> actionApplyColorToAllInSet = std::make_unique<QAction>("Apply Current Color to All In Set");
-	std::unique_ptr<QTimer> animationRepeatingTimer = std::make_unique<QTimer>();
-};
-
-struct poseData
-{
-	const QString assetStr;
-	std::map<ComponentType, componentData> componentMap;
-	std::map<ComponentType, int> displayOrderZOverrideMap;
-	std::unique_ptr<QAction> actionPose = std::make_unique<QAction>();
-};
-
-struct genderData
-{
-	const QString assetStr;
-	std::map<PoseType, poseData> poseMap;
-	std::unique_ptr<QAction> actionGender = std::make_unique<QAction>();
-};
-
-struct speciesData
-{
-	const QString assetStr;
-	std::map<ComponentType, componentUiData> componentUiMap;
-	std::map<GenderType, genderData> genderMap;
-	std::unique_ptr<QAction> actionSpecies = std::make_unique<QAction>();
-};
-
 struct mapInitData
 {
 	const QString assetStr;
@@ -188,10 +97,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		false, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch.png"
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch-hover.png"
@@ -204,8 +109,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{-1, -1}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		nullptr, // SWAP COMPONENT BTN: Alignment in grid layout
-		{-1, -1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		nullptr, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -221,10 +124,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartEyes.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartEyesHover.png"
@@ -237,8 +136,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{0, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -254,10 +151,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartLips.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartLipsHover.png"
@@ -270,8 +163,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{1, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -287,10 +178,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_NO_OUTLINE,
 		false, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch.png"
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch-hover.png"
@@ -303,8 +190,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{-1, -1}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		nullptr, // SWAP COMPONENT BTN: Alignment in grid layout
-		{-1, -1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		nullptr, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -320,10 +205,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::NONE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		false, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHead.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHeadHover.png"
@@ -333,8 +214,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		nullptr, // PICK COLOR BTN: Alignment in grid layout
 		{4, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -350,10 +229,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartNeck.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartNeckHover.png"
@@ -366,8 +241,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{5, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -383,10 +256,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartBottom.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartBottomHover.png"
@@ -399,8 +268,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{8, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -416,10 +283,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartJacket.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartJacketHover.png"
@@ -432,8 +295,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{6, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -449,10 +310,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartChest.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartChestHover.png"
@@ -465,8 +322,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{7, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -482,10 +337,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartFeet.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartFeetHover.png"
@@ -498,8 +349,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{9, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -515,10 +364,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartMask.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartMaskHover.png"
@@ -531,8 +376,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		nullptr, // PICK COLOR BTN: Alignment in grid layout
 		{2, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -548,10 +391,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHair.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHairHover.png"
@@ -564,8 +403,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForHuman =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{3, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -585,10 +422,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		false, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch.png"
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch-hover.png"
@@ -601,8 +434,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{-1, -1}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		nullptr, // SWAP COMPONENT BTN: Alignment in grid layout
-		{-1, -1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		nullptr, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -620,10 +451,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartEyes.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartEyesHover.png"
@@ -636,8 +463,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{0, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -653,10 +478,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartLips.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartLipsHover.png"
@@ -669,8 +490,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{1, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -686,10 +505,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_NO_OUTLINE,
 		false, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch.png"
 		<< ":/ZenCharacterCreator2D/Resources/button-left-pencil-sketch-hover.png"
@@ -702,8 +517,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{-1, -1}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		nullptr, // SWAP COMPONENT BTN: Alignment in grid layout
-		{-1, -1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		nullptr, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -719,10 +532,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		false, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartElfEars.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartElfEarsHover.png"
@@ -732,8 +541,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		nullptr, // PICK COLOR BTN: Alignment in grid layout
 		{4, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -750,10 +557,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::NONE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		false, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHead.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHeadHover.png"
@@ -763,8 +566,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		nullptr, // PICK COLOR BTN: Alignment in grid layout
 		{5, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -780,10 +581,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartNeck.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartNeckHover.png"
@@ -796,8 +593,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{6, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -813,10 +608,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartBottom.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartBottomHover.png"
@@ -829,8 +620,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{9, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -846,10 +635,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartJacket.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartJacketHover.png"
@@ -862,8 +647,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{7, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -879,10 +662,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartChest.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartChestHover.png"
@@ -895,8 +674,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{8, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -912,10 +689,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartFeet.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartFeetHover.png"
@@ -928,8 +701,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{10, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -945,10 +716,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartMask.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartMaskHover.png"
@@ -961,8 +728,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		nullptr, // PICK COLOR BTN: Alignment in grid layout
 		{2, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -978,10 +743,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		ColorSetType::FILL_WITH_OUTLINE,
 		true, // SWAP BTN: Flag for whether part is expected to display btn
 		true, // PICK COLOR BTN: Flag for whether part is expected to display btn
-		"QPushButton{background: #FFFFFF; border: none; image: url(%1);}"
-		"QPushButton:hover:!pressed{background: #F8F1E6; border: none; image: url(%2);}"
-		"QPushButton:hover:pressed{background: #F8F1E6; border: none; image: url(%3);}",
-		"QPushButton{background: #E5884E; border: none; image: url(%1);}",
 		QStringList()
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHair.png"
 		<< ":/ZenCharacterCreator2D/Resources/btnSwapCharacterPartHairHover.png"
@@ -994,8 +755,6 @@ const std::map<ComponentType, componentDataSettings> componentTypeMapForElf =
 		Qt::AlignLeft | Qt::AlignTop, // PICK COLOR BTN: Alignment in grid layout
 		{3, 0}, // SWAP COMPONENT BTN: Row/Col placement in grid layout
 		Qt::AlignRight, // SWAP COMPONENT BTN: Alignment in grid layout
-		{0, 1}, // SWAP ASSET BTN: Row/Col placement in grid layout
-		Qt::AlignRight, // SWAP ASSET BTN: Alignment in grid layout
 		75, // SWAP BTN: Width
 		75, // SWAP BTN: Height
 		75, // PICK COLOR BTN: Width
@@ -0,0 +1,102 @@
+/*
+This file is part of Zen Character Creator 2D.
+	Zen Character Creator 2D is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+	Zen Character Creator 2D is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	You should have received a copy of the GNU General Public License
+	along with Zen Character Creator 2D.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+// Times CharacterFile::parse on synthetic .zen2dx files of growing size (the same character with 1x, 10x and
+// 100x its component lines), to check that parsing stays linear in file size: the time per KB should stay
+// flat across the rows. Needs no assets or GUI, so it runs anywhere the app's Qt libraries are.
+// Usage: CharacterFileBenchmark [iterations per size, default 200]
+
+#include "../CharacterCreator2d/CharacterFile.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+	// Roughly what a saved character holds, with componentCount component lines
+	// (every fourth one multicolor, as hair and clothing tend to be).
+	characterFileData syntheticCharacter(const int componentCount)
+	{
+		characterFileData character;
+		character.hasSpeciesGenderPose = true;
+		character.speciesStr = "Human";
+		character.genderStr = "Female";
+		character.poseStr = "FrontFacing";
+		for (int i = 0; i < componentCount; i++)
+		{
+			characterFileComponentData component;
+			component.assetStr = QString("Component%1").arg(i);
+			component.imgFilename = QString("asset%1").arg(i);
+			component.color = QColor::fromHsv((i * 37) % 360, 120, 200);
+			component.combined = i % 4 == 0;
+			if (component.combined)
+			{
+				for (int part = 0; part < 3; part++)
+					component.subColorList.emplace_back(characterFileSubColorData{ QString("asset%1_part%2").arg(i).arg(part), QColor::fromHsv((i * 53 + part * 90) % 360, 90, 180) });
+			}
+			character.componentList.emplace_back(std::move(component));
+		}
+		character.hasBackgroundColor = true;
+		character.backgroundColor = QColor("#FFFFFF");
+		character.hasBackgroundImage = true;
+		character.backgroundImage = "Backgrounds/forest.png";
+		character.fieldList.emplace_back("characterFirstName", "Benchmark");
+		character.fieldList.emplace_back("characterLastName", "Character");
+		return character;
+	}
+
+	// Median of the runs, so a stray context switch doesn't skew a row.
+	qint64 medianParseNsecs(const QString &contents, const int iterations)
+	{
+		std::vector<qint64> nsecsList;
+		nsecsList.reserve(iterations);
+		std::size_t componentCount = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			QElapsedTimer timer;
+			timer.start();
+			const characterFileData character = CharacterFile::parse(contents);
+			nsecsList.emplace_back(timer.nsecsElapsed());
+			componentCount += character.componentList.size(); // Keeps the parse from being optimized out.
+		}
+		std::nth_element(nsecsList.begin(), nsecsList.begin() + nsecsList.size() / 2, nsecsList.end());
+		return componentCount > 0 ? nsecsList[nsecsList.size() / 2] : 0;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	const int iterations = app.arguments().size() > 1 ? std::max(1, app.arguments().at(1).toInt()) : 200;
+	const int baseComponentCount = 13; // As many components as a species has.
+
+	QTextStream out(stdout);
+	out << "scale\tcomponents\tbytes\tmedian us\tns per KB\n";
+	double baseNsecsPerKb = 0;
+	for (const int scale : { 1, 10, 100 })
+	{
+		const QString contents = CharacterFile::toText(syntheticCharacter(baseComponentCount * scale));
+		const qint64 bytes = contents.toUtf8().size();
+		const qint64 nsecs = medianParseNsecs(contents, iterations);
+		const double nsecsPerKb = nsecs * 1024.0 / bytes;
+		if (scale == 1)
+			baseNsecsPerKb = nsecsPerKb;
+		out << scale << "x\t" << baseComponentCount * scale << "\t" << bytes << "\t" << nsecs / 1000.0 << "\t"
+			<< qRound(nsecsPerKb) << " (" << QString::number(nsecsPerKb / baseNsecsPerKb, 'f', 2) << "x of 1x)\n";
+	}
+	return 0;
+}